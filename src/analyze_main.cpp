@@ -0,0 +1,252 @@
+/**
+ * @file analyze_main.cpp
+ * @brief Batch replay analytics over archived recording files.
+ *
+ * Streams any number of recordings, resimulates each headlessly
+ * through Update(), and aggregates statistics: death-cause
+ * distribution, final and per-tick average length, and a normalized
+ * heatmap of apple spawn positions. Files are dealt to one worker per
+ * core off a shared atomic cursor; every worker owns a private
+ * accumulator and the results are merged once at the end, so the hot
+ * loop has no shared writes at all.
+ *
+ * Usage: SNAKE_ANALYZE [--threads N] [--curve FILE] [--heatmap FILE]
+ *                      RECORDING...
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "game.h"
+#include "recording.h"
+
+/**
+ * @brief Per-thread statistics accumulator, merged after the run.
+ */
+struct ReplayStats
+{
+    static constexpr int CURVE_STRIDE = 64;  /**< Ticks per length-curve bucket */
+    static constexpr int CURVE_BUCKETS = 64; /**< Length-curve buckets (4096 ticks) */
+    static constexpr int HEAT = 32;          /**< Heatmap resolution per axis */
+
+    long files = 0;          /**< Recordings analyzed */
+    long badFiles = 0;       /**< Files that failed to open or validate */
+    long moves = 0;          /**< Total moves resimulated */
+    long wallDeaths = 0;     /**< Games ended by hitting a wall */
+    long selfDeaths = 0;     /**< Games ended by hitting the body */
+    long aliveEnds = 0;      /**< Recordings that end mid-game */
+    long finalLengthSum = 0; /**< Sum of lengths at each game's end */
+    int maxLength = 0;       /**< Longest snake seen */
+    std::uint64_t curveLengthSum[CURVE_BUCKETS] = {}; /**< Length sums per tick bucket */
+    std::uint64_t curveSamples[CURVE_BUCKETS] = {};   /**< Samples per tick bucket */
+    std::uint64_t appleHeat[HEAT * HEAT] = {};        /**< Apple spawns, grid-normalized */
+
+    /** @brief Folds another accumulator into this one. */
+    void Merge(const ReplayStats &other)
+    {
+        files += other.files;
+        badFiles += other.badFiles;
+        moves += other.moves;
+        wallDeaths += other.wallDeaths;
+        selfDeaths += other.selfDeaths;
+        aliveEnds += other.aliveEnds;
+        finalLengthSum += other.finalLengthSum;
+        maxLength = other.maxLength > maxLength ? other.maxLength : maxLength;
+        for (int i = 0; i < CURVE_BUCKETS; ++i)
+        {
+            curveLengthSum[i] += other.curveLengthSum[i];
+            curveSamples[i] += other.curveSamples[i];
+        }
+        for (int i = 0; i < HEAT * HEAT; ++i)
+            appleHeat[i] += other.appleHeat[i];
+    }
+};
+
+/**
+ * @brief Buckets an apple position into the normalized heatmap.
+ */
+static void RecordApple(ReplayStats &stats, const Vector2Int &apple, int width, int height)
+{
+    int hx = apple.x * ReplayStats::HEAT / width;
+    int hy = apple.y * ReplayStats::HEAT / height;
+    ++stats.appleHeat[hy * ReplayStats::HEAT + hx];
+}
+
+/**
+ * @brief Resimulates one recording and folds it into the accumulator.
+ * @param path Recording file path
+ * @param stats Accumulator owned by the calling worker
+ */
+static void AnalyzeFile(const char *path, ReplayStats &stats)
+{
+    GameReplay replay;
+    if (!replay.Open(path))
+    {
+        ++stats.badFiles;
+        return;
+    }
+
+    Game game(replay.Width(), replay.Height(), Direction::RIGHT, {0, 0}, {});
+    ResetGame(game, replay.Seed());
+    RecordApple(stats, game.apple, game.width, game.height);
+
+    bool dead = false;
+    for (long move = 0; move < replay.MoveCount(); ++move)
+    {
+        game.direction = replay.Move(move);
+        Vector2Int prevApple = game.apple;
+
+        if (Update(game))
+        {
+            // The fatal move is the last one recorded; classify it.
+            Vector2Int offset = OffsetFromDirection(game.direction);
+            Vector2Int newHead = {game.snake.front().x + offset.x, game.snake.front().y + offset.y};
+            bool wall = newHead.x < 0 || newHead.x >= game.width ||
+                        newHead.y < 0 || newHead.y >= game.height;
+            ++(wall ? stats.wallDeaths : stats.selfDeaths);
+            stats.moves += move + 1;
+            dead = true;
+            break;
+        }
+
+        if (!(game.apple == prevApple))
+            RecordApple(stats, game.apple, game.width, game.height);
+
+        int bucket = static_cast<int>(move / ReplayStats::CURVE_STRIDE);
+        if (bucket < ReplayStats::CURVE_BUCKETS)
+        {
+            stats.curveLengthSum[bucket] += game.snake.size();
+            ++stats.curveSamples[bucket];
+        }
+    }
+
+    if (!dead)
+    {
+        ++stats.aliveEnds;
+        stats.moves += replay.MoveCount();
+    }
+
+    ++stats.files;
+    stats.finalLengthSum += game.snake.size();
+    if (game.snake.size() > stats.maxLength)
+        stats.maxLength = game.snake.size();
+}
+
+/**
+ * @brief Writes the average-length curve as tick,avg_length CSV.
+ */
+static void DumpCurve(const ReplayStats &stats, const char *path)
+{
+    std::FILE *file = std::fopen(path, "w");
+    if (!file)
+        return;
+    std::fprintf(file, "tick,avg_length\n");
+    for (int i = 0; i < ReplayStats::CURVE_BUCKETS; ++i)
+        if (stats.curveSamples[i])
+            std::fprintf(file, "%d,%.3f\n", i * ReplayStats::CURVE_STRIDE,
+                         static_cast<double>(stats.curveLengthSum[i]) / stats.curveSamples[i]);
+    std::fclose(file);
+}
+
+/**
+ * @brief Writes the apple heatmap as HEAT rows of HEAT counts.
+ */
+static void DumpHeatmap(const ReplayStats &stats, const char *path)
+{
+    std::FILE *file = std::fopen(path, "w");
+    if (!file)
+        return;
+    for (int y = 0; y < ReplayStats::HEAT; ++y)
+    {
+        for (int x = 0; x < ReplayStats::HEAT; ++x)
+            std::fprintf(file, x ? ",%llu" : "%llu",
+                         static_cast<unsigned long long>(stats.appleHeat[y * ReplayStats::HEAT + x]));
+        std::fprintf(file, "\n");
+    }
+    std::fclose(file);
+}
+
+int main(int argc, char **argv)
+{
+    int threadCount = static_cast<int>(std::thread::hardware_concurrency());
+    const char *curvePath = nullptr;
+    const char *heatmapPath = nullptr;
+    std::vector<const char *> paths;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            threadCount = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--curve") == 0 && i + 1 < argc)
+            curvePath = argv[++i];
+        else if (std::strcmp(argv[i], "--heatmap") == 0 && i + 1 < argc)
+            heatmapPath = argv[++i];
+        else
+            paths.push_back(argv[i]);
+    }
+
+    if (paths.empty())
+    {
+        std::fprintf(stderr,
+                     "usage: %s [--threads N] [--curve FILE] [--heatmap FILE] RECORDING...\n",
+                     argv[0]);
+        return 1;
+    }
+    if (threadCount < 1)
+        threadCount = 1;
+    if (threadCount > static_cast<int>(paths.size()))
+        threadCount = static_cast<int>(paths.size());
+
+    std::atomic<std::size_t> cursor{0};
+    std::vector<ReplayStats> perThread(threadCount);
+
+    auto started = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+    for (int t = 0; t < threadCount; ++t)
+    {
+        workers.emplace_back([&, t]
+        {
+            for (;;)
+            {
+                std::size_t index = cursor.fetch_add(1, std::memory_order_relaxed);
+                if (index >= paths.size())
+                    return;
+                AnalyzeFile(paths[index], perThread[t]);
+            }
+        });
+    }
+    for (std::thread &worker : workers)
+        worker.join();
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+    ReplayStats total;
+    for (const ReplayStats &stats : perThread)
+        total.Merge(stats);
+
+    std::printf("files %ld (bad %ld), moves %ld in %.3f s\n",
+                total.files, total.badFiles, total.moves, elapsed);
+    std::printf("throughput %.2fM moves/sec (%.2fM per thread, %d threads)\n",
+                total.moves / elapsed / 1e6, total.moves / elapsed / 1e6 / threadCount,
+                threadCount);
+    std::printf("deaths: wall %ld, self %ld, still alive %ld\n",
+                total.wallDeaths, total.selfDeaths, total.aliveEnds);
+    if (total.files)
+        std::printf("final length: avg %.2f, max %d\n",
+                    static_cast<double>(total.finalLengthSum) / total.files, total.maxLength);
+
+    if (curvePath)
+        DumpCurve(total, curvePath);
+    if (heatmapPath)
+        DumpHeatmap(total, heatmapPath);
+    return 0;
+}
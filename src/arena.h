@@ -0,0 +1,146 @@
+/**
+ * @file arena.h
+ * @brief Monotonic arena backing a game's transient buffers.
+ *
+ * A Game needs several per-cell tables (body ring, occupancy grid,
+ * free-cell index) whose capacities are all fixed by the grid size.
+ * Instead of giving each its own heap allocation, the arena makes one
+ * allocation up front and carves it with a bump pointer, so
+ * constructing a game costs a single allocation and resetting one
+ * costs nothing — the tables just reset their counts in place.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+
+/**
+ * @brief Bump allocator over a single fixed-size block.
+ *
+ * Allocations are never freed individually; Reset() reclaims the whole
+ * block at once. Only implicit-lifetime element types (plain structs,
+ * ints, bools) may be allocated, since the arena does not run
+ * constructors.
+ */
+class MonotonicArena
+{
+public:
+    MonotonicArena() = default;
+
+    /**
+     * @brief Construct an arena owning a block of the given size.
+     * @param bytes Block size in bytes
+     */
+    explicit MonotonicArena(std::size_t bytes)
+        : block(std::make_unique<std::byte[]>(bytes)), capacity(bytes) {}
+
+    /**
+     * @brief Worst-case bytes needed to allocate count elements of T.
+     *
+     * Includes alignment padding, for sizing the arena up front.
+     *
+     * @param count Number of elements
+     * @return Bytes to budget for the allocation
+     */
+    template <typename T>
+    static constexpr std::size_t BytesFor(std::size_t count)
+    {
+        return count * sizeof(T) + alignof(T);
+    }
+
+    /**
+     * @brief Carves an aligned span of count elements from the block.
+     *
+     * The elements are uninitialized; the caller fills them. The arena
+     * must have been sized to fit all allocations made against it.
+     *
+     * @param count Number of elements
+     * @return Span over the carved storage
+     */
+    template <typename T>
+    std::span<T> Allocate(std::size_t count)
+    {
+        std::size_t aligned = (offset + alignof(T) - 1) & ~(alignof(T) - 1);
+        offset = aligned + count * sizeof(T);
+        return {reinterpret_cast<T *>(block.get() + aligned), count};
+    }
+
+    /** @brief Reclaims the whole block; outstanding spans become free for reuse. */
+    void Reset() { offset = 0; }
+
+    /** @brief Block size in bytes. */
+    std::size_t Capacity() const { return capacity; }
+
+private:
+    std::unique_ptr<std::byte[]> block; /**< The arena's single allocation */
+    std::size_t capacity = 0;           /**< Block size in bytes */
+    std::size_t offset = 0;             /**< Bump pointer into the block */
+};
+
+/**
+ * @brief Fixed-capacity vector view over arena storage.
+ *
+ * Mirrors the slice of the std::vector interface the game code uses,
+ * but never owns or grows its storage, so every operation is
+ * allocation-free by construction.
+ */
+template <typename T>
+class FixedVector
+{
+public:
+    FixedVector() = default;
+
+    /**
+     * @brief Construct a view over the given storage, initially empty.
+     * @param storage Backing storage; capacity is its extent
+     */
+    explicit FixedVector(std::span<T> storage) : storage(storage) {}
+
+    /** @brief True when no elements are held. */
+    bool empty() const { return count == 0; }
+
+    /** @brief Number of elements held. */
+    int size() const { return count; }
+
+    /** @brief Last element. */
+    const T &back() const { return storage[count - 1]; }
+
+    /** @brief Element access. */
+    T &operator[](int i) { return storage[i]; }
+
+    /** @brief Element access. */
+    const T &operator[](int i) const { return storage[i]; }
+
+    /** @brief Appends an element; caller stays within capacity. */
+    void push_back(const T &value) { storage[count++] = value; }
+
+    /** @brief Drops the last element. */
+    void pop_back() { --count; }
+
+    /**
+     * @brief Sets the size to n elements, left uninitialized.
+     * @param n New size; caller fills the elements
+     */
+    void resize(int n) { count = n; }
+
+    /**
+     * @brief Sets the size to n copies of value.
+     * @param n New size
+     * @param value Fill value
+     */
+    void assign(int n, const T &value)
+    {
+        count = n;
+        std::fill(storage.begin(), storage.begin() + n, value);
+    }
+
+private:
+    std::span<T> storage; /**< Arena-backed storage, fixed capacity */
+    int count = 0;        /**< Number of live elements */
+};
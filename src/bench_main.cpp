@@ -0,0 +1,183 @@
+/**
+ * @file bench_main.cpp
+ * @brief Microbenchmarks for the simulation hot path.
+ *
+ * Covers the operations that dominate training throughput: single-tick
+ * Update() across snake lengths, collision checks, apple respawn on
+ * dense boards, and full-game headless throughput. Built as the
+ * SNAKE_BENCH target so performance-motivated changes come with
+ * numbers.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <utility>
+
+#include "game.h"
+#include "static_game.h"
+
+namespace
+{
+
+/**
+ * @brief Times a callable and reports nanoseconds per iteration.
+ * @param name Benchmark label
+ * @param iterations Number of calls to time
+ * @param fn Callable to benchmark
+ */
+template <typename F>
+void Bench(const char *name, long iterations, F &&fn)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; ++i)
+        fn();
+    auto elapsed = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count();
+    std::printf("%-40s %12.1f ns/op  (%ld iters)\n", name, elapsed / iterations, iterations);
+}
+
+/**
+ * @brief Direction of the Hamiltonian cycle at a cell (width must be even).
+ *
+ * Even columns run down, odd columns run up, and the top row is the
+ * return lane; following it visits every cell, so a snake of any
+ * length can move forever without colliding.
+ *
+ * @param pos Current head position
+ * @param width Grid width (even)
+ * @param height Grid height
+ * @return Direction the cycle takes from pos
+ */
+Direction CycleDirection(const Vector2Int &pos, int width, int height)
+{
+    using enum Direction;
+    if (pos.y == 0)
+        return pos.x == 0 ? DOWN : LEFT;
+    if (pos.x % 2 == 0)
+        return pos.y == height - 1 ? RIGHT : DOWN;
+    if (pos.y == 1)
+        return pos.x == width - 1 ? UP : RIGHT;
+    return UP;
+}
+
+/**
+ * @brief Builds a game whose snake lies along the Hamiltonian cycle.
+ * @param width Grid width (even)
+ * @param height Grid height
+ * @param length Desired snake length
+ * @return Game ready to step along the cycle indefinitely
+ */
+Game MakeCycleGame(int width, int height, int length)
+{
+    Game game(width, height, Direction::DOWN, {-1, -1}, {{0, 0}});
+    Vector2Int pos{0, 0};
+    for (int i = 1; i < length; ++i)
+    {
+        Vector2Int offset = OffsetFromDirection(CycleDirection(pos, width, height));
+        pos = {pos.x + offset.x, pos.y + offset.y};
+        game.snake.push_front(pos);
+        game.Occupy(pos);
+    }
+    game.direction = CycleDirection(pos, width, height);
+    return game;
+}
+
+/**
+ * @brief Benchmarks one Update() tick at a given snake length.
+ * @param width Grid width
+ * @param height Grid height
+ * @param length Snake length to measure at
+ */
+void BenchUpdateAtLength(int width, int height, int length)
+{
+    Game game = MakeCycleGame(width, height, length);
+    char name[64];
+    std::snprintf(name, sizeof(name), "Update, length %d (%dx%d)", length, width, height);
+    Bench(name, 2'000'000, [&]
+    {
+        game.direction = CycleDirection(game.snake.front(), game.width, game.height);
+        Update(game);
+    });
+}
+
+/**
+ * @brief Benchmarks apple respawn at a given board occupancy.
+ * @param width Grid width
+ * @param height Grid height
+ * @param length Snake length occupying the board
+ */
+void BenchAppleRespawn(int width, int height, int length)
+{
+    Game game = MakeCycleGame(width, height, length);
+    char name[64];
+    std::snprintf(name, sizeof(name), "Apple respawn, %d%% full",
+                length * 100 / (width * height));
+    Bench(name, 2'000'000, [&]
+    {
+        game.apple = GetNewApplePosition(game);
+    });
+}
+
+} // namespace
+
+/**
+ * @brief Runs every benchmark and prints one line per measurement.
+ * @return Exit status
+ */
+int main()
+{
+    constexpr int WIDTH = 64;
+    constexpr int HEIGHT = 64;
+
+    for (int length : {3, 256, 1024, 3072})
+        BenchUpdateAtLength(WIDTH, HEIGHT, length);
+
+    {
+        Game game = MakeCycleGame(WIDTH, HEIGHT, 1024);
+        Vector2Int head = game.snake.front();
+        Bench("IsGameOver, 4 candidate moves", 2'000'000, [&]
+        {
+            using enum Direction;
+            bool blocked = false;
+            for (Direction dir : {UP, DOWN, LEFT, RIGHT})
+            {
+                Vector2Int offset = OffsetFromDirection(dir);
+                blocked |= IsGameOver(game, {head.x + offset.x, head.y + offset.y});
+            }
+            if (blocked && game.width == 0) std::puts(""); // keep the result live
+        });
+    }
+
+    for (int length : {2048, 3686, 4055})
+        BenchAppleRespawn(WIDTH, HEIGHT, length);
+
+    {
+        Game game(WIDTH, HEIGHT, Direction::RIGHT, {0, 0}, {});
+        ResetGame(game, 42);
+        Xoshiro256 turns(7);
+        Bench("Full game tick, random policy", 2'000'000, [&]
+        {
+            QueueDirection(game, static_cast<Direction>(turns.NextBelow(4)));
+            if (Update(game))
+                ResetGame(game);
+        });
+    }
+
+    {
+        auto game = std::make_unique<StaticGame<WIDTH, HEIGHT>>();
+        game->Reset(42);
+        Xoshiro256 turns(7);
+        Bench("Full game tick, StaticGame<64,64>", 2'000'000, [&]
+        {
+            game->QueueDirection(static_cast<Direction>(turns.NextBelow(4)));
+            if (game->Update())
+                game->Reset();
+        });
+    }
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+/**
+ * @file board_analysis.cpp
+ * @brief Implementation of the word-parallel board analysis kernels.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#include "board_analysis.h"
+
+#include <algorithm>
+#include <bit>
+
+Bitboard::Bitboard(int width, int height)
+    : width(width), height(height), rowWords((width + 63) / 64),
+      tailMask(width % 64 ? (1ULL << (width % 64)) - 1 : ~0ULL),
+      words(rowWords * height, 0)
+{
+}
+
+void Bitboard::FromOccupancy(const Game &game)
+{
+    words.assign(words.size(), 0);
+    for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x)
+            if (game.occupancy[y * width + x])
+                Set(x, y);
+}
+
+int Bitboard::Count() const
+{
+    int count = 0;
+    for (std::uint64_t word : words)
+        count += std::popcount(word);
+    return count;
+}
+
+void Bitboard::Dilate(std::vector<std::uint64_t> &mask, std::vector<std::uint64_t> &scratch) const
+{
+    scratch.assign(mask.size(), 0);
+
+    for (int y = 0; y < height; ++y)
+    {
+        const std::uint64_t *row = mask.data() + y * rowWords;
+        std::uint64_t *out = scratch.data() + y * rowWords;
+
+        for (int w = 0; w < rowWords; ++w)
+        {
+            std::uint64_t center = row[w];
+            std::uint64_t left = center >> 1;
+            std::uint64_t right = center << 1;
+            if (w + 1 < rowWords)
+                left |= row[w + 1] << 63;
+            if (w > 0)
+                right |= row[w - 1] >> 63;
+            out[w] = center | left | right;
+        }
+    }
+
+    // Vertical neighbors must come from the un-dilated input, so keep a
+    // copy of the previous original row as rows are overwritten in place.
+    std::vector<std::uint64_t> prevRow(rowWords, 0);
+    std::vector<std::uint64_t> currRow(rowWords);
+
+    for (int y = 0; y < height; ++y)
+    {
+        std::uint64_t *out = mask.data() + y * rowWords;
+        const std::uint64_t *mid = scratch.data() + y * rowWords;
+        const std::uint64_t *down = y + 1 < height ? mask.data() + (y + 1) * rowWords : nullptr;
+
+        std::copy(out, out + rowWords, currRow.begin());
+
+        for (int w = 0; w < rowWords; ++w)
+        {
+            std::uint64_t merged = mid[w] | prevRow[w];
+            if (down)
+                merged |= down[w];
+            std::uint64_t valid = w == rowWords - 1 ? tailMask : ~0ULL;
+            out[w] = merged & valid;
+        }
+
+        std::swap(prevRow, currRow);
+    }
+}
+
+int FloodFillCount(const Bitboard &blocked, Vector2Int start)
+{
+    if (start.x < 0 || start.x >= blocked.width || start.y < 0 || start.y >= blocked.height ||
+        blocked.Test(start.x, start.y))
+        return 0;
+
+    std::vector<std::uint64_t> visited(blocked.words.size(), 0);
+    std::vector<std::uint64_t> scratch;
+    visited[start.y * blocked.rowWords + (start.x >> 6)] = 1ULL << (start.x & 63);
+
+    int count = 1;
+    for (;;)
+    {
+        std::vector<std::uint64_t> next = visited;
+        blocked.Dilate(next, scratch);
+        for (std::size_t w = 0; w < next.size(); ++w)
+            next[w] &= ~blocked.words[w];
+
+        int newCount = 0;
+        for (std::uint64_t word : next)
+            newCount += std::popcount(word);
+        if (newCount == count)
+            return count;
+
+        count = newCount;
+        visited = std::move(next);
+    }
+}
+
+void DistanceMap(const Bitboard &blocked, Vector2Int start,
+                 std::vector<std::uint16_t> &distances)
+{
+    distances.assign(blocked.width * blocked.height, 0xFFFF);
+    if (start.x < 0 || start.x >= blocked.width || start.y < 0 || start.y >= blocked.height ||
+        blocked.Test(start.x, start.y))
+        return;
+
+    std::vector<std::uint64_t> visited(blocked.words.size(), 0);
+    std::vector<std::uint64_t> scratch;
+    visited[start.y * blocked.rowWords + (start.x >> 6)] = 1ULL << (start.x & 63);
+    distances[start.y * blocked.width + start.x] = 0;
+
+    for (std::uint16_t wave = 1;; ++wave)
+    {
+        std::vector<std::uint64_t> next = visited;
+        blocked.Dilate(next, scratch);
+        for (std::size_t w = 0; w < next.size(); ++w)
+            next[w] &= ~blocked.words[w];
+
+        bool grew = false;
+        for (int y = 0; y < blocked.height; ++y)
+        {
+            for (int w = 0; w < blocked.rowWords; ++w)
+            {
+                std::uint64_t fresh = next[y * blocked.rowWords + w] &
+                                      ~visited[y * blocked.rowWords + w];
+                while (fresh)
+                {
+                    int bit = std::countr_zero(fresh);
+                    fresh &= fresh - 1;
+                    distances[y * blocked.width + w * 64 + bit] = wave;
+                    grew = true;
+                }
+            }
+        }
+        if (!grew)
+            return;
+        visited = std::move(next);
+    }
+}
+
+std::uint8_t SafeMoveMask(const Game &game)
+{
+    const Vector2Int &head = game.snake.front();
+    std::uint8_t mask = 0;
+
+    if (!IsGameOver(game, {head.x, head.y - 1})) mask |= MOVE_UP;
+    if (!IsGameOver(game, {head.x, head.y + 1})) mask |= MOVE_DOWN;
+    if (!IsGameOver(game, {head.x - 1, head.y})) mask |= MOVE_LEFT;
+    if (!IsGameOver(game, {head.x + 1, head.y})) mask |= MOVE_RIGHT;
+
+    return mask;
+}
@@ -0,0 +1,253 @@
+/**
+ * @file game.cpp
+ * @brief Implementation of the core snake simulation logic.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#include "game.h"
+#include "recording.h"
+
+#include <algorithm>
+
+Vector2Int OffsetFromDirection(Direction dir)
+{
+    using enum Direction;
+    switch (dir)
+    {
+    case UP: return {0, -1};
+    case DOWN: return {0, 1};
+    case LEFT: return {-1, 0};
+    case RIGHT: return {1, 0};
+    }
+}
+
+bool IsGameOver(const Game &game, const Vector2Int &newHead)
+{
+    if (newHead.x < 0 || newHead.x >= game.width || newHead.y < 0 || newHead.y >= game.height)
+        return true;
+    return game.occupancy[newHead.y * game.width + newHead.x];
+}
+
+Vector2Int GetNewApplePosition(Game &game)
+{
+    if (!game.freeCells.empty())
+        return game.freeCells[game.rng.NextBelow(game.freeCells.size())];
+
+    return Vector2Int{0, 0};
+}
+
+void ResetGame(Game &game)
+{
+    int centerX = game.width / 2;
+    int centerY = game.height / 2;
+
+    Vector2Int head = {centerX, centerY};
+    Vector2Int offset = OffsetFromDirection(game.direction);
+    Vector2Int second = {head.x - offset.x, head.y - offset.y};
+    Vector2Int third = {second.x - offset.x, second.y - offset.y};
+
+    game.snake = {head, second, third};
+    game.ClearBoard();
+    for (int i = 0; i < game.snake.size(); ++i)
+        game.Occupy(game.snake[i]);
+    game.apple = GetNewApplePosition(game);
+    game.RecomputeHash();
+    game.vacatedCells.clear();
+    game.boardDirty = true;
+    game.journal.clear();
+    game.snapshotMarks.clear();
+}
+
+void Game::Restore()
+{
+    std::size_t mark = snapshotMarks.back();
+    snapshotMarks.pop_back();
+
+    while (journal.size() > mark)
+    {
+        const TickDelta &delta = journal.back();
+
+        if (delta.ateApple)
+        {
+            apple = delta.prevApple;
+            rng = delta.prevRng;
+        }
+        else
+        {
+            snake.push_back(delta.prevTail);
+            UndoVacate(delta.prevTail);
+        }
+
+        UndoOccupy(delta.newHead, delta.headOccupySlot);
+        snake.pop_front();
+
+        direction = delta.prevDirection;
+        directionQueue = delta.prevQueue;
+        hash = delta.prevHash;
+        journal.pop_back();
+    }
+
+    // Cell-level dirty tracking does not survive a rollback; repaint fully.
+    vacatedCells.clear();
+    boardDirty = true;
+}
+
+void ResetGame(Game &game, std::uint64_t seed)
+{
+    game.rng.Seed(seed);
+    ResetGame(game);
+}
+
+void ResizeBoard(Game &game, int newWidth, int newHeight)
+{
+    // Lift the body out of the arena before re-carving it. On a
+    // shrink the body is truncated at the first segment that no
+    // longer fits, so the surviving prefix stays contiguous.
+    std::vector<Vector2Int> segments;
+    segments.reserve(game.snake.size());
+    for (int i = 0; i < game.snake.size(); ++i)
+    {
+        const Vector2Int &segment = game.snake[i];
+        if (segment.x >= newWidth || segment.y >= newHeight)
+        {
+            if (i == 0)
+                segments.clear();
+            break;
+        }
+        segments.push_back(segment);
+    }
+
+    game.width = newWidth;
+    game.height = newHeight;
+    int cells = newWidth * newHeight;
+    if (Game::ArenaBytes(cells) > game.arena.Capacity())
+        game.arena = MonotonicArena(Game::ArenaBytes(cells));
+    else
+        game.arena.Reset();
+    game.snake = SnakeBody(game.arena.Allocate<Vector2Int>(cells));
+    game.occupancy = FixedVector<bool>(game.arena.Allocate<bool>(cells));
+    game.freeCells = FixedVector<Vector2Int>(game.arena.Allocate<Vector2Int>(cells));
+    game.freeSlot = FixedVector<int>(game.arena.Allocate<int>(cells));
+    game.ClearBoard();
+
+    if (segments.empty())
+    {
+        ResetGame(game);
+        return;
+    }
+
+    for (const Vector2Int &segment : segments)
+        game.snake.push_back(segment);
+    for (int i = 0; i < game.snake.size(); ++i)
+        game.Occupy(game.snake[i]);
+
+    if (game.apple.x >= newWidth || game.apple.y >= newHeight ||
+        game.occupancy[game.apple.y * newWidth + game.apple.x])
+        game.apple = GetNewApplePosition(game);
+
+    // Cell keys depend on the grid width, so the hash must be rebuilt.
+    game.RecomputeHash();
+    game.vacatedCells.clear();
+    game.boardDirty = true;
+    game.journal.clear();
+    game.snapshotMarks.clear();
+}
+
+void QueueDirection(Game &game, Direction newDirection)
+{
+    using enum Direction;
+    if (game.directionQueue.size() >= 3)
+        return;
+
+    Direction lastDirection = game.directionQueue.empty() ? game.direction : game.directionQueue.back();
+
+    if ((newDirection == LEFT && lastDirection != RIGHT) ||
+        (newDirection == RIGHT && lastDirection != LEFT) ||
+        (newDirection == UP && lastDirection != DOWN) ||
+        (newDirection == DOWN && lastDirection != UP))
+    {
+        game.directionQueue.push(newDirection);
+    }
+}
+
+void QueueDirections(Game &game, std::span<const Direction> newDirections)
+{
+    for (Direction newDirection : newDirections)
+        QueueDirection(game, newDirection);
+}
+
+bool Update(Game &game)
+{
+    bool journaling = !game.snapshotMarks.empty();
+    TickDelta delta;
+    if (journaling)
+    {
+        delta.prevDirection = game.direction;
+        delta.prevQueue = game.directionQueue;
+        delta.prevHash = game.hash;
+    }
+
+    if (!game.directionQueue.empty())
+    {
+        game.direction = game.directionQueue.front();
+        game.directionQueue.pop();
+    }
+
+    // Recorded before the collision check so a replay sees the fatal move too.
+    if (game.recorder)
+        game.recorder->RecordTick(game.direction);
+
+    Vector2Int offset = OffsetFromDirection(game.direction);
+    Vector2Int newHead{game.snake.front().x + offset.x, game.snake.front().y + offset.y};
+
+    if (IsGameOver(game, newHead))
+    {
+        // Nothing was applied, so journaled exploration needs no record;
+        // only the direction/queue changes above have to be rolled back.
+        if (journaling)
+        {
+            game.direction = delta.prevDirection;
+            game.directionQueue = delta.prevQueue;
+        }
+        return true;
+    }
+
+    game.hash ^= game.ZobristKey(game.snake.front(), Game::ZOBRIST_HEAD) ^
+                 game.ZobristKey(newHead, Game::ZOBRIST_HEAD) ^
+                 game.ZobristKey(newHead, Game::ZOBRIST_BODY);
+    game.snake.push_front(newHead);
+    delta.newHead = newHead;
+    delta.headOccupySlot = game.Occupy(newHead);
+
+    if (newHead == game.apple)
+    {
+        delta.ateApple = true;
+        delta.prevApple = game.apple;
+        delta.prevRng = game.rng;
+        game.apple = GetNewApplePosition(game);
+        game.hash ^= game.ZobristKey(delta.prevApple, Game::ZOBRIST_APPLE) ^
+                     game.ZobristKey(game.apple, Game::ZOBRIST_APPLE);
+    }
+    else
+    {
+        delta.ateApple = false;
+        delta.prevTail = game.snake.back();
+        game.hash ^= game.ZobristKey(game.snake.back(), Game::ZOBRIST_BODY);
+        game.Vacate(game.snake.back());
+        // Remember the emptied cell for the dirty-cell renderer; if nothing
+        // drains the list (headless runs), collapse it into a full repaint
+        // so it cannot grow without bound.
+        if (static_cast<int>(game.vacatedCells.size()) < game.width * game.height)
+            game.vacatedCells.push_back(game.snake.back());
+        else
+            game.boardDirty = true;
+        game.snake.pop_back();
+    }
+
+    if (journaling)
+        game.journal.push_back(delta);
+
+    return false;
+}
@@ -0,0 +1,389 @@
+/**
+ * @file game.h
+ * @brief Core snake simulation state and logic, independent of rendering.
+ *
+ * Everything in this header runs without Raylib or a window, so the
+ * simulation can be driven both by the graphical game loop and by
+ * headless tools.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "arena.h"
+#include "rng.h"
+#include "snake_body.h"
+#include "types.h"
+
+/**
+ * @brief Inline fixed-size ring buffer of pending directions.
+ *
+ * Replaces std::queue<Direction>, whose backing deque heap-allocates
+ * on first use. The queue is capped at three pending moves, so four
+ * inline slots cover it with zero allocation.
+ */
+struct DirectionQueue
+{
+    static constexpr int CAPACITY = 4; /**< Inline slots, one above the pending cap */
+
+    Direction entries[CAPACITY]; /**< Pending directions, oldest first */
+    int head = 0;                /**< Slot of the oldest entry */
+    int count = 0;               /**< Number of pending entries */
+
+    /** @brief True when no directions are pending. */
+    bool empty() const { return count == 0; }
+
+    /** @brief Number of pending directions. */
+    int size() const { return count; }
+
+    /** @brief Oldest pending direction. */
+    Direction front() const { return entries[head]; }
+
+    /** @brief Most recently queued direction. */
+    Direction back() const { return entries[(head + count - 1) % CAPACITY]; }
+
+    /** @brief Appends a direction; caller checks the cap. */
+    void push(Direction direction)
+    {
+        entries[(head + count) % CAPACITY] = direction;
+        ++count;
+    }
+
+    /** @brief Drops the oldest pending direction. */
+    void pop()
+    {
+        head = (head + 1) % CAPACITY;
+        --count;
+    }
+};
+
+class GameRecorder;
+
+/**
+ * @brief Exact-inverse undo record for one applied Update() tick.
+ *
+ * Everything a tick can touch is captured so rollback restores the
+ * state bit-for-bit, including free-cell index ordering and the PRNG —
+ * a restored game continues exactly as if the exploration never
+ * happened, which keeps recordings replayable.
+ */
+struct TickDelta
+{
+    Direction prevDirection;  /**< Direction before the tick */
+    DirectionQueue prevQueue; /**< Pending-direction queue before the tick */
+    std::uint64_t prevHash;   /**< Position hash before the tick */
+    Vector2Int newHead;       /**< Head cell the tick occupied */
+    int headOccupySlot;       /**< freeCells slot newHead was swap-removed from */
+    bool ateApple;            /**< True if the tick consumed the apple */
+    Vector2Int prevTail;      /**< Tail cell vacated (valid when !ateApple) */
+    Vector2Int prevApple;     /**< Apple before respawn (valid when ateApple) */
+    Xoshiro256 prevRng;       /**< PRNG before respawn (valid when ateApple) */
+};
+
+/**
+ * @brief Represents the game state.
+ */
+struct Game
+{
+    int width;                     /**< Width of the game grid */
+    int height;                    /**< Height of the game grid */
+    MonotonicArena arena;          /**< Backing block for the per-cell tables below */
+    SnakeBody snake;               /**< Snake body coordinates, head first */
+    Vector2Int apple;              /**< Current apple position */
+    Direction direction;           /**< Current snake direction */
+    DirectionQueue directionQueue; /**< Queue of next directions */
+    FixedVector<bool> occupancy;   /**< Per-cell snake occupancy, indexed y * width + x */
+    FixedVector<Vector2Int> freeCells; /**< Dense array of all currently empty cells */
+    FixedVector<int> freeSlot;     /**< Index of each cell in freeCells, -1 if occupied */
+    Xoshiro256 rng;                /**< Game-local PRNG, reseeded via ResetGame */
+    std::vector<Vector2Int> vacatedCells; /**< Cells emptied since the last render drain */
+    bool boardDirty = true;        /**< True when the whole board needs a repaint */
+    GameRecorder *recorder = nullptr; /**< Optional per-tick move recorder */
+    std::vector<TickDelta> journal;   /**< Undo records while snapshots are active */
+    std::vector<std::size_t> snapshotMarks; /**< Journal length at each Snapshot */
+    std::uint64_t hash = 0;        /**< Incremental Zobrist hash of the position */
+
+    static constexpr std::uint64_t ZOBRIST_BODY = 0;  /**< Key stream for occupied cells */
+    static constexpr std::uint64_t ZOBRIST_HEAD = 1;  /**< Key stream for the head cell */
+    static constexpr std::uint64_t ZOBRIST_APPLE = 2; /**< Key stream for the apple cell */
+
+    /**
+     * @brief Arena bytes needed for a grid with the given cell count.
+     * @param cells Grid cell count
+     * @return Bytes covering the body ring, occupancy, and free-cell index
+     */
+    static constexpr std::size_t ArenaBytes(std::size_t cells)
+    {
+        return MonotonicArena::BytesFor<Vector2Int>(cells) * 2 +
+               MonotonicArena::BytesFor<bool>(cells) +
+               MonotonicArena::BytesFor<int>(cells);
+    }
+
+    /**
+     * @brief Construct a new Game object.
+     *
+     * Makes the arena's single allocation and carves all per-cell
+     * tables from it; no later operation on the game allocates.
+     *
+     * @param w Width of the grid
+     * @param h Height of the grid
+     * @param dir Initial snake direction
+     * @param applePos Initial apple position
+     * @param initialSnake Initial snake body, head first
+     */
+    Game(int w, int h, Direction dir, const Vector2Int &applePos, std::initializer_list<Vector2Int> initialSnake)
+        : width(w), height(h), arena(ArenaBytes(w * h)),
+          snake(arena.Allocate<Vector2Int>(w * h)), apple(applePos), direction(dir),
+          occupancy(arena.Allocate<bool>(w * h)),
+          freeCells(arena.Allocate<Vector2Int>(w * h)),
+          freeSlot(arena.Allocate<int>(w * h))
+    {
+        ClearBoard();
+        this->snake = initialSnake;
+        for (int i = 0; i < snake.size(); ++i)
+            Occupy(snake[i]);
+        RecomputeHash();
+    }
+
+    /**
+     * @brief Zobrist key for a cell in one of the key streams.
+     *
+     * Keys are derived on demand with the splitmix64 finalizer instead
+     * of a precomputed table, so they work for any grid size at the
+     * cost of a few multiplies — cheap enough for the two or three
+     * keys a tick touches.
+     *
+     * @param pos Cell position
+     * @param stream ZOBRIST_BODY, ZOBRIST_HEAD, or ZOBRIST_APPLE
+     * @return 64-bit key, well mixed across cells and streams
+     */
+    std::uint64_t ZobristKey(const Vector2Int &pos, std::uint64_t stream) const
+    {
+        std::uint64_t z = (static_cast<std::uint64_t>(pos.y) * width + pos.x) * 3 + stream;
+        z += 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief 64-bit hash of the current position.
+     *
+     * XOR of a key per occupied cell, the head cell, and the apple,
+     * maintained incrementally by Update() in O(1) — lookahead search
+     * can memoize positions without walking the body. Two positions
+     * that occupy the same cells with the same head and apple share a
+     * hash even if their interior body ordering differs; such states
+     * are rarely distinguishable within a search horizon anyway.
+     *
+     * @return Position hash
+     */
+    std::uint64_t Hash() const { return hash; }
+
+    /**
+     * @brief Rebuilds the hash from scratch in O(length).
+     *
+     * Used when the position changes wholesale (reset, resize);
+     * per-tick maintenance stays incremental.
+     */
+    void RecomputeHash()
+    {
+        hash = ZobristKey(apple, ZOBRIST_APPLE);
+        for (int i = 0; i < snake.size(); ++i)
+            hash ^= ZobristKey(snake[i], ZOBRIST_BODY);
+        if (snake.size() > 0)
+            hash ^= ZobristKey(snake.front(), ZOBRIST_HEAD);
+    }
+
+    /**
+     * @brief Marks a cell as occupied, swap-removing it from the free-cell index.
+     * @param pos Cell to occupy
+     * @return Slot the cell was removed from, for exact rollback
+     */
+    int Occupy(const Vector2Int &pos)
+    {
+        int cell = pos.y * width + pos.x;
+        occupancy[cell] = true;
+
+        int slot = freeSlot[cell];
+        Vector2Int last = freeCells.back();
+        freeCells[slot] = last;
+        freeSlot[last.y * width + last.x] = slot;
+        freeCells.pop_back();
+        freeSlot[cell] = -1;
+        return slot;
+    }
+
+    /**
+     * @brief Exact inverse of Occupy, given the slot it reported.
+     * @param pos Cell to free again
+     * @param slot Slot returned by the matching Occupy call
+     */
+    void UndoOccupy(const Vector2Int &pos, int slot)
+    {
+        int cell = pos.y * width + pos.x;
+        occupancy[cell] = false;
+
+        // The occupied cell was the back of freeCells: nothing was moved.
+        if (slot == static_cast<int>(freeCells.size()))
+        {
+            freeCells.push_back(pos);
+            freeSlot[cell] = slot;
+            return;
+        }
+
+        Vector2Int moved = freeCells[slot];
+        freeCells.push_back(moved);
+        freeSlot[moved.y * width + moved.x] = static_cast<int>(freeCells.size()) - 1;
+        freeCells[slot] = pos;
+        freeSlot[cell] = slot;
+    }
+
+    /**
+     * @brief Exact inverse of Vacate, which always appends at the back.
+     * @param pos Cell to re-occupy
+     */
+    void UndoVacate(const Vector2Int &pos)
+    {
+        int cell = pos.y * width + pos.x;
+        occupancy[cell] = true;
+        freeCells.pop_back();
+        freeSlot[cell] = -1;
+    }
+
+    /**
+     * @brief Marks a cell as empty, appending it to the free-cell index.
+     * @param pos Cell to vacate
+     */
+    void Vacate(const Vector2Int &pos)
+    {
+        int cell = pos.y * width + pos.x;
+        occupancy[cell] = false;
+        freeSlot[cell] = static_cast<int>(freeCells.size());
+        freeCells.push_back(pos);
+    }
+
+    /**
+     * @brief Marks the current state so it can be restored later.
+     *
+     * While at least one snapshot is active, Update() logs an undo
+     * record per tick, so forking costs O(ticks explored) instead of
+     * O(snake length). Snapshots nest: each Restore() returns to the
+     * most recent mark. Do not call ResetGame between Snapshot and
+     * Restore; resets discard the journal.
+     */
+    void Snapshot() { snapshotMarks.push_back(journal.size()); }
+
+    /**
+     * @brief Rolls the game back to the most recent Snapshot.
+     *
+     * Restores state exactly, including free-cell ordering and the
+     * PRNG, so post-restore play matches a game that never forked.
+     * The dirty-render state is collapsed into a full repaint.
+     */
+    void Restore();
+
+    /**
+     * @brief Resets the board to fully empty without touching the snake.
+     */
+    void ClearBoard()
+    {
+        occupancy.assign(width * height, false);
+        freeCells.resize(width * height);
+        freeSlot.resize(width * height);
+        for (int cell = 0; cell < width * height; ++cell)
+        {
+            freeCells[cell] = {cell % width, cell / width};
+            freeSlot[cell] = cell;
+        }
+    }
+};
+
+/**
+ * @brief Returns the coordinate offset for a given direction.
+ * @param dir Direction to convert
+ * @return Vector2Int offset corresponding to the direction
+ */
+Vector2Int OffsetFromDirection(Direction dir);
+
+/**
+ * @brief Checks whether the snake collides with walls or itself.
+ * @param game Current game state
+ * @param newHead Position of the new snake head
+ * @return True if collision occurs
+ */
+bool IsGameOver(const Game &game, const Vector2Int &newHead);
+
+/**
+ * @brief Generates a random position for the apple, avoiding the snake.
+ * @param game Current game state
+ * @return Valid apple position
+ */
+Vector2Int GetNewApplePosition(Game &game);
+
+/**
+ * @brief Resets the snake and apple to start a new game.
+ *
+ * The game's PRNG stream continues across resets, so a sequence of
+ * games remains replayable from the seed of the first.
+ *
+ * @param game Game state to reset
+ */
+void ResetGame(Game &game);
+
+/**
+ * @brief Reseeds the game's PRNG, then resets the snake and apple.
+ * @param game Game state to reset
+ * @param seed Seed for deterministic replay
+ */
+void ResetGame(Game &game, std::uint64_t seed);
+
+/**
+ * @brief Remaps an in-progress game onto a new grid size.
+ *
+ * The snake, heading, pending directions, and PRNG carry over;
+ * migrating them costs O(length). The per-cell tables are re-carved
+ * from the game's arena (reallocated only when the new grid outgrows
+ * it) and refilled with one linear sweep — no per-cell re-derivation
+ * from game state. On a shrink, body segments that fall outside the
+ * new grid are dropped from the tail; a game whose head falls outside
+ * is reset instead. The apple is kept when still valid, respawned
+ * otherwise. Active snapshots are discarded, like ResetGame.
+ *
+ * @param game Game state to remap
+ * @param newWidth New grid width
+ * @param newHeight New grid height
+ */
+void ResizeBoard(Game &game, int newWidth, int newHeight);
+
+/**
+ * @brief Adds a valid direction to the snake's movement queue.
+ * @param game Game state
+ * @param newDirection Direction to enqueue
+ */
+void QueueDirection(Game &game, Direction newDirection);
+
+/**
+ * @brief Enqueues a sequence of directions in one call.
+ *
+ * Programmatic entry point for bot drivers and replays: each direction
+ * passes through the same reversal and pending-cap rules as
+ * QueueDirection, with no keyboard polling involved.
+ *
+ * @param game Game state
+ * @param newDirections Directions to enqueue, oldest first
+ */
+void QueueDirections(Game &game, std::span<const Direction> newDirections);
+
+/**
+ * @brief Updates the snake's position and game state.
+ * @param game Game state
+ * @return True if game over occurs, false otherwise
+ */
+bool Update(Game &game);
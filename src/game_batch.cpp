@@ -0,0 +1,129 @@
+/**
+ * @file game_batch.cpp
+ * @brief Implementation of the structure-of-arrays batch engine.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#include "game_batch.h"
+
+GameBatch::GameBatch(int count, int width, int height, std::uint64_t seed)
+    : count(count), width(width), height(height), capacity(width * height),
+      bodies(count * capacity), heads(count), tails(count), lengths(count),
+      apples(count), directions(count, Direction::RIGHT),
+      pendingDirections(count, Direction::RIGHT),
+      occupancy(count * capacity, 0),
+      gen(static_cast<std::mt19937::result_type>(seed))
+{
+    for (int game = 0; game < count; ++game)
+        Reset(game);
+}
+
+void GameBatch::Reset(int game)
+{
+    std::uint8_t *cells = occupancy.data() + game * capacity;
+    std::fill(cells, cells + capacity, 0);
+
+    Vector2Int head = {width / 2, height / 2};
+    directions[game] = Direction::RIGHT;
+    pendingDirections[game] = Direction::RIGHT;
+    Vector2Int offset = OffsetFromDirection(directions[game]);
+
+    Vector2Int *body = bodies.data() + game * capacity;
+    heads[game] = 0;
+    tails[game] = 2;
+    lengths[game] = 3;
+    for (int i = 0; i < 3; ++i)
+    {
+        body[i] = {head.x - offset.x * i, head.y - offset.y * i};
+        cells[body[i].y * width + body[i].x] = 1;
+    }
+
+    apples[game] = NewApplePosition(game);
+}
+
+Vector2Int GameBatch::NewApplePosition(int game)
+{
+    const std::uint8_t *cells = occupancy.data() + game * capacity;
+
+    // Rejection sampling is O(1) in expectation until the board is
+    // nearly full; after a bounded number of misses fall back to a scan.
+    std::uniform_int_distribution cellDis(0, capacity - 1);
+    for (int attempt = 0; attempt < 32; ++attempt)
+    {
+        int cell = cellDis(gen);
+        if (!cells[cell])
+            return {cell % width, cell / width};
+    }
+
+    int freeCount = 0;
+    for (int cell = 0; cell < capacity; ++cell)
+        freeCount += !cells[cell];
+    if (freeCount == 0)
+        return {0, 0};
+
+    std::uniform_int_distribution pickDis(0, freeCount - 1);
+    int target = pickDis(gen);
+    for (int cell = 0; cell < capacity; ++cell)
+    {
+        if (!cells[cell] && target-- == 0)
+            return {cell % width, cell / width};
+    }
+    return {0, 0};
+}
+
+void GameBatch::SetDirection(int game, Direction newDirection)
+{
+    using enum Direction;
+    Direction lastDirection = pendingDirections[game];
+
+    if ((newDirection == LEFT && lastDirection != RIGHT) ||
+        (newDirection == RIGHT && lastDirection != LEFT) ||
+        (newDirection == UP && lastDirection != DOWN) ||
+        (newDirection == DOWN && lastDirection != UP))
+    {
+        pendingDirections[game] = newDirection;
+    }
+}
+
+void GameBatch::Step()
+{
+    for (int game = 0; game < count; ++game)
+    {
+        directions[game] = pendingDirections[game];
+        Vector2Int offset = OffsetFromDirection(directions[game]);
+
+        Vector2Int *body = bodies.data() + game * capacity;
+        std::uint8_t *cells = occupancy.data() + game * capacity;
+
+        Vector2Int head = body[heads[game]];
+        Vector2Int newHead{head.x + offset.x, head.y + offset.y};
+
+        bool dead = newHead.x < 0 || newHead.x >= width ||
+                    newHead.y < 0 || newHead.y >= height ||
+                    cells[newHead.y * width + newHead.x];
+        if (dead)
+        {
+            ++gamesCompleted;
+            Reset(game);
+            continue;
+        }
+
+        heads[game] = heads[game] == 0 ? capacity - 1 : heads[game] - 1;
+        body[heads[game]] = newHead;
+        cells[newHead.y * width + newHead.x] = 1;
+
+        if (newHead == apples[game])
+        {
+            ++lengths[game];
+            apples[game] = NewApplePosition(game);
+        }
+        else
+        {
+            Vector2Int tail = body[tails[game]];
+            cells[tail.y * width + tail.x] = 0;
+            tails[game] = tails[game] == 0 ? capacity - 1 : tails[game] - 1;
+        }
+    }
+}
@@ -0,0 +1,103 @@
+/**
+ * @file game_batch.h
+ * @brief Structure-of-arrays engine for stepping many games at once.
+ *
+ * Stores the state of N independent games in contiguous per-field
+ * arrays (heads, tails, lengths, apples, directions, bodies, occupancy)
+ * so that stepping all games round-robin streams through memory instead
+ * of chasing one heap-allocated deque per game. Used by bot-evaluation
+ * runs that simulate thousands of games per generation.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "game.h"
+
+/**
+ * @brief Steps N independent games of identical grid size in one call.
+ *
+ * All games share one grid size; per-game state lives in flat arrays
+ * indexed by game number. Snake bodies are fixed-capacity ring buffers
+ * carved out of a single contiguous slab, so no per-move allocation
+ * ever happens after construction.
+ */
+class GameBatch
+{
+public:
+    /**
+     * @brief Construct a batch of games, all reset and ready to step.
+     * @param count Number of games in the batch
+     * @param width Grid width shared by all games
+     * @param height Grid height shared by all games
+     * @param seed Seed for apple placement across the whole batch
+     */
+    GameBatch(int count, int width, int height, std::uint64_t seed);
+
+    /**
+     * @brief Queues a direction change for one game, applied on its next step.
+     *
+     * Reversals (e.g. LEFT while moving RIGHT) are ignored, matching
+     * QueueDirection().
+     *
+     * @param game Game index
+     * @param newDirection Direction to apply
+     */
+    void SetDirection(int game, Direction newDirection);
+
+    /**
+     * @brief Advances every game in the batch by one tick.
+     *
+     * Games that die are counted and immediately reset, so the batch
+     * can be stepped indefinitely.
+     */
+    void Step();
+
+    /**
+     * @brief Resets one game to its initial three-segment state.
+     * @param game Game index
+     */
+    void Reset(int game);
+
+    /** @brief Number of games in the batch. */
+    int Count() const { return count; }
+
+    /** @brief Current head position of a game. */
+    Vector2Int Head(int game) const { return bodies[game * capacity + heads[game]]; }
+
+    /** @brief Current apple position of a game. */
+    Vector2Int Apple(int game) const { return apples[game]; }
+
+    /** @brief Current snake length of a game. */
+    int Length(int game) const { return lengths[game]; }
+
+    /** @brief Total deaths (and auto-resets) across all games so far. */
+    long GamesCompleted() const { return gamesCompleted; }
+
+private:
+    /** @brief Picks a random empty cell for a game's apple. */
+    Vector2Int NewApplePosition(int game);
+
+    int count;     /**< Number of games */
+    int width;     /**< Grid width */
+    int height;    /**< Grid height */
+    int capacity;  /**< Ring-buffer capacity per game (width * height) */
+
+    std::vector<Vector2Int> bodies;   /**< Ring-buffer slab, capacity cells per game */
+    std::vector<int> heads;           /**< Ring index of each game's head */
+    std::vector<int> tails;           /**< Ring index of each game's tail */
+    std::vector<int> lengths;         /**< Snake length per game */
+    std::vector<Vector2Int> apples;   /**< Apple position per game */
+    std::vector<Direction> directions;        /**< Current direction per game */
+    std::vector<Direction> pendingDirections; /**< Direction queued for next step per game */
+    std::vector<std::uint8_t> occupancy;      /**< Per-cell occupancy, width * height cells per game */
+
+    std::mt19937 gen;        /**< Batch-wide PRNG for apple placement */
+    long gamesCompleted = 0; /**< Total deaths across the batch */
+};
@@ -0,0 +1,63 @@
+/**
+ * @file headless_main.cpp
+ * @brief Headless simulation driver for bot evaluation and benchmarking.
+ *
+ * Runs the core simulation (Update, QueueDirection, ResetGame) in a
+ * tight loop with no window, GPU context, or frame pacing. Used to
+ * replay and evaluate large numbers of games at full CPU speed.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "game.h"
+
+/**
+ * @brief Entry point of the headless simulator.
+ *
+ * Usage: SNAKE_HEADLESS [ticks] [width] [height] [seed]
+ *
+ * Steps a single game for the requested number of ticks, feeding it
+ * random (always-valid) direction changes and restarting on death,
+ * then reports games completed and throughput.
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return Exit status
+ */
+int main(int argc, char **argv)
+{
+    long totalTicks = argc > 1 ? std::atol(argv[1]) : 1'000'000;
+    int width = argc > 2 ? std::atoi(argv[2]) : 25;
+    int height = argc > 3 ? std::atoi(argv[3]) : 25;
+    std::uint64_t seed = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : std::random_device{}();
+
+    Game game(width, height, Direction::RIGHT, {0, 0}, {});
+    ResetGame(game, seed);
+
+    std::mt19937 gen(static_cast<std::mt19937::result_type>(seed));
+    std::uniform_int_distribution turnDis(0, 3);
+
+    long gamesCompleted = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (long tick = 0; tick < totalTicks; ++tick)
+    {
+        QueueDirection(game, static_cast<Direction>(turnDis(gen)));
+        if (Update(game))
+        {
+            ++gamesCompleted;
+            ResetGame(game);
+        }
+    }
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("%ld ticks, %ld games in %.3f s (%.0f ticks/sec)\n",
+                totalTicks, gamesCompleted, elapsed, totalTicks / elapsed);
+    return 0;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file input.h
+ * @brief Pluggable source of direction intents for the game loop.
+ *
+ * The game loop pulls intents from an InputSource once per frame and
+ * feeds them through QueueDirections, so the keyboard, bot drivers,
+ * and replay playback all inject moves through the same seam instead
+ * of each loop hard-coding its own polling.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "types.h"
+
+/**
+ * @brief Produces direction intents, one batch per frame.
+ */
+class InputSource
+{
+public:
+    virtual ~InputSource() = default;
+
+    /**
+     * @brief Appends any new direction intents, oldest first.
+     *
+     * Called once per frame; an idle source appends nothing and should
+     * cost near-zero.
+     *
+     * @param intents Receives the intents produced this frame
+     */
+    virtual void Poll(std::vector<Direction> &intents) = 0;
+};
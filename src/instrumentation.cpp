@@ -0,0 +1,75 @@
+/**
+ * @file instrumentation.cpp
+ * @brief Implementation of the latency histograms.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#include "instrumentation.h"
+
+#include <bit>
+
+int LatencyHistogram::Bucket(std::uint64_t ns)
+{
+    if (ns < SUB_BUCKETS)
+        return static_cast<int>(ns);
+
+    int msb = 63 - std::countl_zero(ns);
+    int shift = msb - 4;
+    return (shift << 4) + static_cast<int>((ns >> shift) & (SUB_BUCKETS - 1)) + SUB_BUCKETS;
+}
+
+std::uint64_t LatencyHistogram::BucketLow(int bucket)
+{
+    if (bucket < SUB_BUCKETS)
+        return static_cast<std::uint64_t>(bucket);
+
+    int shift = (bucket - SUB_BUCKETS) >> 4;
+    std::uint64_t sub = (bucket - SUB_BUCKETS) & (SUB_BUCKETS - 1);
+    return (SUB_BUCKETS + sub) << shift;
+}
+
+std::uint64_t LatencyHistogram::Percentile(double fraction) const
+{
+    if (total == 0)
+        return 0;
+
+    auto target = static_cast<std::uint64_t>(fraction * total);
+    std::uint64_t seen = 0;
+    for (int bucket = 0; bucket < BUCKETS; ++bucket)
+    {
+        seen += counts[bucket];
+        if (seen > target)
+            return BucketLow(bucket);
+    }
+    return maxValue;
+}
+
+void LatencyHistogram::Dump(std::FILE *file, const char *name) const
+{
+    std::fprintf(file, "# %s: %llu samples, p50=%llu p99=%llu max=%llu (ns)\n",
+                 name,
+                 static_cast<unsigned long long>(total),
+                 static_cast<unsigned long long>(Percentile(0.50)),
+                 static_cast<unsigned long long>(Percentile(0.99)),
+                 static_cast<unsigned long long>(maxValue));
+    for (int bucket = 0; bucket < BUCKETS; ++bucket)
+    {
+        if (counts[bucket])
+            std::fprintf(file, "%llu %llu\n",
+                         static_cast<unsigned long long>(BucketLow(bucket)),
+                         static_cast<unsigned long long>(counts[bucket]));
+    }
+}
+
+bool FrameStats::DumpToFile(const char *path) const
+{
+    std::FILE *file = std::fopen(path, "w");
+    if (!file)
+        return false;
+
+    updateTime.Dump(file, "update");
+    renderTime.Dump(file, "render");
+    return std::fclose(file) == 0;
+}
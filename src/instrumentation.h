@@ -0,0 +1,109 @@
+/**
+ * @file instrumentation.h
+ * @brief Latency histograms and per-frame timing capture.
+ *
+ * Records Update() and render durations into HDR-style log-linear
+ * histograms (fixed bucket array, no allocation per record) plus a
+ * small ring of recent frame times for plotting, so stutter reports
+ * can be pinned to the phase that actually spiked. Histograms can be
+ * dumped to a text file on exit for offline analysis.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+
+/**
+ * @brief Log-linear latency histogram over nanosecond values.
+ *
+ * Values below 16 ns get exact buckets; above that, each power of two
+ * is split into 16 linear sub-buckets, giving ~6% relative precision
+ * across the full 64-bit range with under 1000 fixed counters.
+ */
+class LatencyHistogram
+{
+public:
+    /**
+     * @brief Records one measured duration.
+     * @param ns Duration in nanoseconds
+     */
+    void Record(std::uint64_t ns)
+    {
+        counts[Bucket(ns)] += 1;
+        ++total;
+        if (ns > maxValue)
+            maxValue = ns;
+    }
+
+    /**
+     * @brief Value at or below which the given fraction of samples fall.
+     * @param fraction Percentile as a fraction, e.g. 0.99
+     * @return Approximate duration in nanoseconds, 0 if empty
+     */
+    std::uint64_t Percentile(double fraction) const;
+
+    /** @brief Largest recorded value in nanoseconds. */
+    std::uint64_t Max() const { return maxValue; }
+
+    /** @brief Number of recorded samples. */
+    std::uint64_t Count() const { return total; }
+
+    /**
+     * @brief Appends "bucket_ns count" lines for non-empty buckets.
+     * @param file Open file to write to
+     * @param name Histogram label written as a section header
+     */
+    void Dump(std::FILE *file, const char *name) const;
+
+private:
+    /** @brief Linear sub-buckets per power of two. */
+    static constexpr int SUB_BUCKETS = 16;
+
+    /** @brief Total fixed bucket count covering the uint64 range. */
+    static constexpr int BUCKETS = SUB_BUCKETS + (64 - 4) * SUB_BUCKETS;
+
+    /** @brief Maps a nanosecond value to its bucket index. */
+    static int Bucket(std::uint64_t ns);
+
+    /** @brief Lower edge of a bucket in nanoseconds. */
+    static std::uint64_t BucketLow(int bucket);
+
+    std::array<std::uint64_t, BUCKETS> counts{}; /**< Per-bucket sample counts */
+    std::uint64_t total = 0;    /**< Total samples */
+    std::uint64_t maxValue = 0; /**< Largest recorded value */
+};
+
+/**
+ * @brief Timing capture for the game loop's phases.
+ */
+struct FrameStats
+{
+    static constexpr int PLOT_FRAMES = 240; /**< Frame times kept for plotting */
+
+    LatencyHistogram updateTime; /**< Simulation tick durations */
+    LatencyHistogram renderTime; /**< Render (canvas + submit) durations */
+    std::array<float, PLOT_FRAMES> frameTimes{}; /**< Recent frame times in seconds */
+    int frameCursor = 0;         /**< Next slot in frameTimes */
+
+    /**
+     * @brief Records one whole-frame duration for the plot.
+     * @param seconds Frame time in seconds
+     */
+    void PushFrame(float seconds)
+    {
+        frameTimes[frameCursor] = seconds;
+        frameCursor = (frameCursor + 1) % PLOT_FRAMES;
+    }
+
+    /**
+     * @brief Writes both histograms to a text file.
+     * @param path Destination file path
+     * @return True on success
+     */
+    bool DumpToFile(const char *path) const;
+};
@@ -0,0 +1,27 @@
+/**
+ * @file keyboard_input.cpp
+ * @brief Implementation of the keyboard InputSource.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#include "keyboard_input.h"
+
+#include <raylib.h>
+
+void KeyboardInputSource::Poll(std::vector<Direction> &intents)
+{
+    using enum Direction;
+    for (int key = GetKeyPressed(); key != 0; key = GetKeyPressed())
+    {
+        switch (key)
+        {
+        case KEY_A: case KEY_LEFT:  intents.push_back(LEFT);  break;
+        case KEY_D: case KEY_RIGHT: intents.push_back(RIGHT); break;
+        case KEY_W: case KEY_UP:    intents.push_back(UP);    break;
+        case KEY_S: case KEY_DOWN:  intents.push_back(DOWN);  break;
+        default: break; // Non-movement keys stay with IsKeyPressed toggles.
+        }
+    }
+}
@@ -0,0 +1,25 @@
+/**
+ * @file keyboard_input.h
+ * @brief Keyboard-backed InputSource draining Raylib's key event queue.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include "input.h"
+
+/**
+ * @brief Translates Raylib key press events into direction intents.
+ *
+ * Drains the key event queue with GetKeyPressed() instead of probing
+ * eight keys with IsKeyPressed() every frame: on an idle frame the
+ * queue is empty and polling is a single call, and simultaneous
+ * presses come out in press order rather than probe order.
+ */
+class KeyboardInputSource : public InputSource
+{
+public:
+    void Poll(std::vector<Direction> &intents) override;
+};
@@ -1,320 +1,314 @@
 /**
- * @file snake.cpp
+ * @file main.cpp
  * @brief Classic Snake game implementation using Raylib.
  *
- * This file contains all game logic, rendering, and input handling
- * for a simple snake game on a grid.
- * 
+ * This file contains the windowed game loop. The simulation lives in
+ * game.h / game.cpp, drawing in renderer.h / renderer.cpp, and
+ * movement input in input.h / keyboard_input.cpp.
+ *
  * @author CJendantix
  * @date 2025-10-22
  */
 
-#include <ranges>
-#include <raylib.h>
-#include <queue>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <mutex>
 #include <random>
-
-/**
- * @brief Represents the four possible movement directions of the snake.
- */
-enum class Direction
-{
-    UP,    /**< Move up */
-    DOWN,  /**< Move down */
-    LEFT,  /**< Move left */
-    RIGHT  /**< Move right */
-};
-
-/**
- * @brief Represents a 2D integer vector for grid coordinates.
- */
-struct Vector2Int
-{
-    int x; /**< X coordinate */
-    int y; /**< Y coordinate */
-
-    /**
-     * @brief Equality operator.
-     * @param other Vector to compare
-     * @return True if both x and y match
-     */
-    bool operator==(const Vector2Int &other) const = default;
-};
-
-/**
- * @brief Represents the game state.
- */
-struct Game
-{
-    int width;                     /**< Width of the game grid */
-    int height;                    /**< Height of the game grid */
-    std::deque<Vector2Int> snake;  /**< Snake body coordinates */
-    Vector2Int apple;              /**< Current apple position */
-    Direction direction;           /**< Current snake direction */
-    std::queue<Direction> directionQueue; /**< Queue of next directions */
-
-    /**
-     * @brief Construct a new Game object.
-     * @param w Width of the grid
-     * @param h Height of the grid
-     * @param dir Initial snake direction
-     * @param applePos Initial apple position
-     * @param initialSnake Initial snake body
-     */
-    Game(int w, int h, Direction dir, const Vector2Int &applePos, const std::deque<Vector2Int> &initialSnake)
-        : width(w), height(h), snake(initialSnake), apple(applePos), direction(dir) {}
-};
+#include <raylib.h>
+#include <thread>
+#include <vector>
+
+#include "game.h"
+#include "instrumentation.h"
+#include "keyboard_input.h"
+#include "overlay.h"
+#include "render_state.h"
+#include "renderer.h"
+#include "telemetry.h"
+#include "tick_scheduler.h"
 
 // Screen and game constants
+constexpr int GRID_WIDTH = 25;           /**< Default grid width in cells */
+constexpr int GRID_HEIGHT = 25;          /**< Default grid height in cells */
+constexpr int MIN_GRID = 5;              /**< Smallest playable grid dimension */
 constexpr int SCREEN_WIDTH = 800;        /**< Window width */
 constexpr int SCREEN_HEIGHT = 450;       /**< Window height */
-constexpr int BORDER_THICKNESS = 2;      /**< Border thickness around the game grid */
 constexpr int FPS = 60;                  /**< Target frames per second */
 constexpr float MOVE_INTERVAL = 0.1f;    /**< Time between snake moves in seconds */
-const Color SNAKE_HEAD_COLOR{71, 130, 255, 255}; /**< Base snake head color */
-const Color BORDER_COLOR{0, 0, 0, 255};          /**< Border color */
-const Color BORDER_BG{160, 255, 112, 255};      /**< Background behind the border */
 
 /**
- * @brief Calculates the size of a single grid cell.
- * @param gameWidth Number of cells horizontally
- * @param gameHeight Number of cells vertically
- * @param screenWidth Screen width in pixels
- * @param screenHeight Screen height in pixels
- * @return Cell size in pixels
+ * @brief Manhattan distance from the snake's head to the apple.
+ * @param game Game state
+ * @return Distance in cells
  */
-int GetCellSize(int gameWidth, int gameHeight, int screenWidth, int screenHeight)
+static std::uint16_t AppleDistance(const Game &game)
 {
-    int cellWidth = (screenWidth - BORDER_THICKNESS * 2) / gameWidth;
-    int cellHeight = (screenHeight - BORDER_THICKNESS * 2) / gameHeight;
-    return std::min(cellWidth, cellHeight);
+    const Vector2Int &head = game.snake.front();
+    int dx = head.x > game.apple.x ? head.x - game.apple.x : game.apple.x - head.x;
+    int dy = head.y > game.apple.y ? head.y - game.apple.y : game.apple.y - head.y;
+    return static_cast<std::uint16_t>(dx + dy);
 }
 
 /**
- * @brief Returns the coordinate offset for a given direction.
- * @param dir Direction to convert
- * @return Vector2Int offset corresponding to the direction
+ * @brief Game loop with the simulation on its own thread.
+ *
+ * The simulation thread ticks at MOVE_INTERVAL and publishes immutable
+ * render snapshots through a lock-free triple buffer; the main thread
+ * stays the render thread (Raylib owns the GL context there) and draws
+ * the newest snapshot at its own pace. A slow frame never delays a
+ * tick, and a slow tick never blocks a frame.
+ *
+ * The simulation thread also starts before the window: it constructs
+ * and seeds the game while InitWindow() brings up the GL context, so
+ * cold start pays for only the slower of the two.
+ *
+ * @param gridWidth Grid width in cells
+ * @param gridHeight Grid height in cells
+ * @param telemetryPath Telemetry output file, or nullptr for none
+ * @return Exit status
  */
-Vector2Int OffsetFromDirection(Direction dir)
+int RunThreaded(int gridWidth, int gridHeight, const char *telemetryPath)
 {
-    using enum Direction;
-    switch (dir)
+    Renderer renderer;
+    TripleBuffer states;
+    KeyboardInputSource input;
+    TelemetrySink telemetry;
+    std::atomic<bool> quit{false};
+    std::mutex inputMutex;
+    std::vector<Direction> pendingInputs;
+
+    std::thread sim([&]
     {
-    case UP: return {0, -1};
-    case DOWN: return {0, 1};
-    case LEFT: return {-1, 0};
-    case RIGHT: return {1, 0};
-    }
-}
+        if (telemetryPath)
+            telemetry.Open(telemetryPath);
+        Game game(gridWidth, gridHeight, Direction::RIGHT, {0, 0}, {});
+        ResetGame(game, std::random_device{}());
 
-/**
- * @brief Checks whether the snake collides with walls or itself.
- * @param game Current game state
- * @param newHead Position of the new snake head
- * @return True if collision occurs
- */
-bool IsGameOver(const Game &game, const Vector2Int &newHead)
-{
-    if (newHead.x < 0 || newHead.x >= game.width || newHead.y < 0 || newHead.y >= game.height)
-        return true;
-    return std::ranges::find(game.snake, newHead) != game.snake.end();
-}
+        using Clock = std::chrono::steady_clock;
+        auto interval = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<float>(MOVE_INTERVAL));
+        auto nextTick = Clock::now() + interval;
 
-/**
- * @brief Generates a random position for the apple, avoiding the snake.
- * @param game Current game state
- * @return Valid apple position
- */
-Vector2Int GetNewApplePosition(const Game &game)
-{
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::vector<Vector2Int> emptyCells;
-    for (int x = 0; x < game.width; ++x)
-    {
-        for (int y = 0; y < game.height; ++y)
+        std::uint32_t tickIndex = 0;
+        Clock::time_point inputTime{};
+
+        while (!quit.load(std::memory_order_relaxed))
         {
-            Vector2Int pos{x, y};
-            if (std::ranges::find(game.snake, pos) == game.snake.end())
             {
-                emptyCells.push_back(pos);
+                std::lock_guard lock(inputMutex);
+                if (!pendingInputs.empty() && inputTime == Clock::time_point{})
+                    inputTime = Clock::now();
+                for (Direction intent : pendingInputs)
+                    QueueDirection(game, intent);
+                pendingInputs.clear();
             }
-        }
-    }
-    
-    if (!emptyCells.empty())
-    {
-        std::uniform_int_distribution dis(0, static_cast<int>(emptyCells.size()) - 1);
-        return emptyCells[dis(gen)];
-    }
-
-    return Vector2Int{0, 0};
-}
 
-/**
- * @brief Resets the snake and apple to start a new game.
- * @param game Game state to reset
- */
-void ResetGame(Game &game)
-{
-    int centerX = game.width / 2;
-    int centerY = game.height / 2;
+            bool hadPending = !game.directionQueue.empty();
+            auto tickStart = Clock::now();
+            if (Update(game))
+                ResetGame(game);
+            auto tickEnd = Clock::now();
 
-    Vector2Int head = {centerX, centerY};
-    Vector2Int offset = OffsetFromDirection(game.direction);
-    Vector2Int second = {head.x - offset.x, head.y - offset.y};
-    Vector2Int third = {second.x - offset.x, second.y - offset.y};
+            std::uint32_t inputNs = 0;
+            if (hadPending && inputTime != Clock::time_point{})
+            {
+                inputNs = static_cast<std::uint32_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(tickEnd - inputTime).count());
+                inputTime = {};
+            }
+            telemetry.Record({tickIndex++, static_cast<std::uint16_t>(game.snake.size()),
+                              AppleDistance(game),
+                              static_cast<std::uint32_t>(
+                                  std::chrono::duration_cast<std::chrono::nanoseconds>(tickEnd - tickStart).count()),
+                              inputNs});
+
+            CaptureRenderSnapshot(game, states.Write());
+            states.Publish();
+
+            std::this_thread::sleep_until(nextTick);
+            nextTick += interval;
+            // Resync after a long stall instead of bursting to catch up.
+            if (std::chrono::steady_clock::now() > nextTick + interval * 4)
+                nextTick = std::chrono::steady_clock::now() + interval;
+        }
+    });
 
-    game.snake = {head, second, third};
-    game.apple = GetNewApplePosition(game);
-}
+    SetConfigFlags(FLAG_WINDOW_RESIZABLE);
+    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Snake");
+    SetTargetFPS(FPS);
+    renderer.Prewarm(gridWidth, gridHeight, GetScreenWidth(), GetScreenHeight(), 3);
 
-/**
- * @brief Adds a valid direction to the snake's movement queue.
- * @param game Game state
- * @param newDirection Direction to enqueue
- */
-void QueueDirection(Game &game, Direction newDirection)
-{
-    using enum Direction;
-    if (game.directionQueue.size() >= 3)
-        return;
+    std::vector<Direction> frameIntents;
+    while (!WindowShouldClose())
+    {
+        frameIntents.clear();
+        input.Poll(frameIntents);
+        if (!frameIntents.empty())
+        {
+            std::lock_guard lock(inputMutex);
+            pendingInputs.insert(pendingInputs.end(), frameIntents.begin(), frameIntents.end());
+        }
 
-    Direction lastDirection = game.directionQueue.empty() ? game.direction : game.directionQueue.back();
+        states.Acquire();
+        bool haveState = states.Read().width > 0;
+        if (haveState)
+            renderer.UpdateCanvas(states.Read(), GetScreenWidth(), GetScreenHeight());
 
-    if ((newDirection == LEFT && lastDirection != RIGHT) ||
-        (newDirection == RIGHT && lastDirection != LEFT) ||
-        (newDirection == UP && lastDirection != DOWN) ||
-        (newDirection == DOWN && lastDirection != UP))
-    {
-        game.directionQueue.push(newDirection);
+        BeginDrawing();
+        if (haveState)
+            renderer.Present();
+        else
+            ClearBackground(RAYWHITE);
+        EndDrawing();
     }
-}
 
-/**
- * @brief Handles keyboard input for snake movement.
- * @param game Game state
- */
-void HandleInput(Game &game)
-{
-    using enum Direction;
-    if (IsKeyPressed(KEY_A) || IsKeyPressed(KEY_LEFT)) QueueDirection(game, LEFT);
-    if (IsKeyPressed(KEY_D) || IsKeyPressed(KEY_RIGHT)) QueueDirection(game, RIGHT);
-    if (IsKeyPressed(KEY_W) || IsKeyPressed(KEY_UP)) QueueDirection(game, UP);
-    if (IsKeyPressed(KEY_S) || IsKeyPressed(KEY_DOWN)) QueueDirection(game, DOWN);
+    quit.store(true, std::memory_order_relaxed);
+    sim.join();
+    renderer.Unload();
+    CloseWindow();
+    return 0;
 }
 
 /**
- * @brief Updates the snake's position and game state.
- * @param game Game state
- * @return True if game over occurs, false otherwise
+ * @brief Entry point of the program. Initializes and runs the game loop.
+ * @param argc Argument count
+ * @param argv Argument values; --async for the threaded loop,
+ *             --telemetry <file> to record per-tick telemetry,
+ *             --grid <W>x<H> for a non-default board size
+ * @return Exit status
  */
-bool Update(Game &game)
+int main(int argc, char **argv)
 {
-    if (!game.directionQueue.empty())
+    bool async = false;
+    const char *telemetryPath = nullptr;
+    int gridWidth = GRID_WIDTH;
+    int gridHeight = GRID_HEIGHT;
+    for (int i = 1; i < argc; ++i)
     {
-        game.direction = game.directionQueue.front();
-        game.directionQueue.pop();
+        if (std::strcmp(argv[i], "--async") == 0)
+            async = true;
+        else if (std::strcmp(argv[i], "--telemetry") == 0 && i + 1 < argc)
+            telemetryPath = argv[++i];
+        else if (std::strcmp(argv[i], "--grid") == 0 && i + 1 < argc)
+        {
+            int w = 0;
+            int h = 0;
+            if (std::sscanf(argv[++i], "%dx%d", &w, &h) == 2 && w >= MIN_GRID && h >= MIN_GRID)
+            {
+                gridWidth = w;
+                gridHeight = h;
+            }
+        }
     }
 
-    Vector2Int offset = OffsetFromDirection(game.direction);
-    Vector2Int newHead{game.snake.front().x + offset.x, game.snake.front().y + offset.y};
+    if (async)
+        return RunThreaded(gridWidth, gridHeight, telemetryPath);
 
-    if (IsGameOver(game, newHead)) return true;
-
-    game.snake.push_front(newHead);
-
-    if (newHead == game.apple)
-        game.apple = GetNewApplePosition(game);
-    else
-        game.snake.pop_back();
-
-    return false;
-}
-
-/**
- * @brief Renders the game grid, snake, and apple.
- * @param game Game state
- * @param screenWidth Width of the screen
- * @param screenHeight Height of the screen
- */
-void Render(const Game &game, int screenWidth, int screenHeight)
-{
-    ClearBackground(RAYWHITE);
-
-    int cellSize = GetCellSize(game.width, game.height, screenWidth, screenHeight);
-    int gameWidthPx = cellSize * game.width;
-    int gameHeightPx = cellSize * game.height;
-    int offsetX = (screenWidth - gameWidthPx) / 2;
-    int offsetY = (screenHeight - gameHeightPx) / 2;
-
-    DrawRectangle(offsetX - BORDER_THICKNESS, offsetY - BORDER_THICKNESS,
-                gameWidthPx + BORDER_THICKNESS * 2, gameHeightPx + BORDER_THICKNESS * 2,
-                BORDER_BG);
-
-    DrawRectangleLinesEx(
-        Rectangle{static_cast<float>(offsetX - BORDER_THICKNESS), static_cast<float>(offsetY - BORDER_THICKNESS),
-                static_cast<float>(gameWidthPx + BORDER_THICKNESS * 2), static_cast<float>(gameHeightPx + BORDER_THICKNESS * 2)},
-        static_cast<float>(BORDER_THICKNESS), BORDER_COLOR);
-
-    DrawRectangle(offsetX + game.apple.x * cellSize,
-                offsetY + game.apple.y * cellSize,
-                cellSize, cellSize, RED);
-
-    auto snakeLength = static_cast<int>(game.snake.size());
-    for (int i = 0; i < snakeLength; ++i)
+    // Construct and seed the game off-thread while InitWindow brings
+    // up the window and GL context; cold start pays for the slower of
+    // the two instead of their sum.
+    auto pendingGame = std::async(std::launch::async, [gridWidth, gridHeight]
     {
-        const auto &coord = game.snake[i];
-        int factor = (snakeLength - i) * 255 / snakeLength;
-        Color color = {
-            static_cast<unsigned char>(SNAKE_HEAD_COLOR.r * factor / 255),
-            static_cast<unsigned char>(SNAKE_HEAD_COLOR.g * factor / 255),
-            static_cast<unsigned char>(SNAKE_HEAD_COLOR.b * factor / 255),
-            255
-        };
-
-        DrawRectangle(offsetX + coord.x * cellSize,
-                    offsetY + coord.y * cellSize,
-                    cellSize, cellSize, color);
-    }
-}
+        auto game = std::make_unique<Game>(gridWidth, gridHeight, Direction::RIGHT,
+                                           Vector2Int{0, 0}, std::initializer_list<Vector2Int>{});
+        ResetGame(*game, std::random_device{}());
+        return game;
+    });
 
-/**
- * @brief Entry point of the program. Initializes and runs the game loop.
- * @return Exit status
- */
-int main()
-{
     SetConfigFlags(FLAG_WINDOW_RESIZABLE);
     InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Snake");
     SetTargetFPS(FPS);
 
-    Game game(25, 25, Direction::RIGHT, {0, 0}, {});
-    ResetGame(game);
+    TelemetrySink telemetry;
+    if (telemetryPath)
+        telemetry.Open(telemetryPath);
+
+    Renderer renderer;
+    // Warm every rendering cache during the remaining startup window.
+    renderer.Prewarm(gridWidth, gridHeight, GetScreenWidth(), GetScreenHeight(), 3);
+
+    std::unique_ptr<Game> gamePtr = pendingGame.get();
+    Game &game = *gamePtr;
+    TickScheduler scheduler(MOVE_INTERVAL);
+    FrameStats stats;
+    KeyboardInputSource input;
+    std::vector<Direction> intents;
+    bool showOverlay = false;
+    bool showGridLines = false;
 
-    float moveTimer = 0.0f;
+    using Clock = std::chrono::steady_clock;
+    std::uint32_t tickIndex = 0;
+    Clock::time_point inputTime{};
 
     while (!WindowShouldClose())
     {
-        moveTimer += GetFrameTime();
+        float frameTime = GetFrameTime();
+        stats.PushFrame(frameTime);
+
+        intents.clear();
+        input.Poll(intents);
+        QueueDirections(game, intents);
+        if (IsKeyPressed(KEY_F3))
+            showOverlay = !showOverlay;
+        if (IsKeyPressed(KEY_G))
+        {
+            showGridLines = !showGridLines;
+            renderer.SetGridLines(showGridLines);
+        }
 
-        HandleInput(game);
+        if (!intents.empty() && inputTime == Clock::time_point{})
+            inputTime = Clock::now();
 
-        if (moveTimer >= MOVE_INTERVAL)
+        int ticks = scheduler.Advance(frameTime);
+        for (int tick = 0; tick < ticks; ++tick)
         {
-            moveTimer = 0.0f;
-            if (Update(game))
+            bool hadPending = !game.directionQueue.empty();
+            auto tickStart = Clock::now();
+            bool died = Update(game);
+            auto tickEnd = Clock::now();
+            auto updateNs = std::chrono::duration_cast<std::chrono::nanoseconds>(tickEnd - tickStart).count();
+            stats.updateTime.Record(updateNs);
+
+            std::uint32_t inputNs = 0;
+            if (hadPending && inputTime != Clock::time_point{})
+            {
+                inputNs = static_cast<std::uint32_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(tickEnd - inputTime).count());
+                inputTime = {};
+            }
+            telemetry.Record({tickIndex++, static_cast<std::uint16_t>(game.snake.size()),
+                              AppleDistance(game), static_cast<std::uint32_t>(updateNs), inputNs});
+
+            if (died)
+            {
                 ResetGame(game);
+                scheduler.Reset();
+                break;
+            }
         }
 
         int screenWidth = GetScreenWidth();
         int screenHeight = GetScreenHeight();
 
+        auto renderStart = Clock::now();
+        renderer.UpdateCanvas(game, screenWidth, screenHeight);
+
         BeginDrawing();
-        Render(game, screenWidth, screenHeight);
+        renderer.Present();
+        if (showOverlay)
+            DrawStatsOverlay(stats);
+        // Measured before EndDrawing so vsync wait doesn't drown the signal.
+        stats.renderTime.Record(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - renderStart).count());
         EndDrawing();
     }
 
+    stats.DumpToFile("snake_timings.txt");
+    renderer.Unload();
     CloseWindow();
     return 0;
 }
@@ -0,0 +1,184 @@
+/**
+ * @file multi_game.cpp
+ * @brief Implementation of the multi-snake arena engine.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#include "multi_game.h"
+
+#include <cstdint>
+
+/** @brief Spawn points as board quarters, spread before doubling up. */
+static constexpr Vector2Int SPAWN_QUARTERS[MultiGame::MAX_SNAKES] = {
+    {1, 1}, {3, 3}, {3, 1}, {1, 3}, {2, 1}, {2, 3}, {1, 2}, {3, 2},
+};
+
+MultiGame::MultiGame(int width, int height, int snakeCount, std::uint64_t seed)
+    : width(width), height(height), cells(width * height),
+      snakeCount(snakeCount), aliveCount(snakeCount),
+      owner(cells, 0), freeCells(cells), freeSlot(cells)
+{
+    rng.Seed(seed);
+
+    for (int cell = 0; cell < cells; ++cell)
+    {
+        freeCells[cell] = {cell % width, cell / width};
+        freeSlot[cell] = cell;
+    }
+
+    // Each snake's body ring gets a whole number of cache lines in the
+    // slab so neighboring snakes never share a line.
+    int region = (cells + 7) & ~7;
+    slab.resize(region * snakeCount + 8);
+    auto base = reinterpret_cast<std::uintptr_t>(slab.data());
+    auto aligned = reinterpret_cast<Vector2Int *>((base + 63) & ~std::uintptr_t{63});
+
+    for (int i = 0; i < snakeCount; ++i)
+    {
+        ArenaSnake &snake = snakes[i];
+        Vector2Int spawn = {width * SPAWN_QUARTERS[i].x / 4, height * SPAWN_QUARTERS[i].y / 4};
+
+        int toCenterX = width / 2 - spawn.x;
+        int toCenterY = height / 2 - spawn.y;
+        if ((toCenterX >= 0 ? toCenterX : -toCenterX) >= (toCenterY >= 0 ? toCenterY : -toCenterY))
+            snake.direction = toCenterX >= 0 ? Direction::RIGHT : Direction::LEFT;
+        else
+            snake.direction = toCenterY >= 0 ? Direction::DOWN : Direction::UP;
+
+        snake.body = aligned + region * i;
+        snake.body[0] = spawn;
+        snake.ringHead = 0;
+        snake.length = 1;
+        snake.pendingGrowth = START_GROWTH;
+        snake.alive = true;
+        Occupy(spawn, i);
+    }
+
+    apple = NewApplePosition();
+}
+
+void MultiGame::Occupy(const Vector2Int &pos, int snake)
+{
+    int cell = pos.y * width + pos.x;
+    owner[cell] = static_cast<std::uint8_t>(snake + 1);
+
+    int slot = freeSlot[cell];
+    Vector2Int last = freeCells.back();
+    freeCells[slot] = last;
+    freeSlot[last.y * width + last.x] = slot;
+    freeCells.pop_back();
+    freeSlot[cell] = -1;
+}
+
+void MultiGame::Vacate(const Vector2Int &pos)
+{
+    int cell = pos.y * width + pos.x;
+    owner[cell] = 0;
+    freeSlot[cell] = static_cast<int>(freeCells.size());
+    freeCells.push_back(pos);
+}
+
+Vector2Int MultiGame::NewApplePosition()
+{
+    if (!freeCells.empty())
+        return freeCells[rng.NextBelow(freeCells.size())];
+
+    return Vector2Int{0, 0};
+}
+
+void MultiGame::QueueDirection(int snake, Direction newDirection)
+{
+    using enum Direction;
+    ArenaSnake &s = snakes[snake];
+    if (s.queue.size() >= 3)
+        return;
+
+    Direction lastDirection = s.queue.empty() ? s.direction : s.queue.back();
+
+    if ((newDirection == LEFT && lastDirection != RIGHT) ||
+        (newDirection == RIGHT && lastDirection != LEFT) ||
+        (newDirection == UP && lastDirection != DOWN) ||
+        (newDirection == DOWN && lastDirection != UP))
+    {
+        s.queue.push(newDirection);
+    }
+}
+
+int MultiGame::Step()
+{
+    Vector2Int newHeads[MAX_SNAKES];
+    bool dies[MAX_SNAKES] = {};
+
+    // Phase 1: commit each snake's direction and propose its new head.
+    for (int i = 0; i < snakeCount; ++i)
+    {
+        ArenaSnake &s = snakes[i];
+        if (!s.alive)
+            continue;
+
+        if (!s.queue.empty())
+        {
+            s.direction = s.queue.front();
+            s.queue.pop();
+        }
+
+        Vector2Int offset = OffsetFromDirection(s.direction);
+        const Vector2Int &head = s.body[s.ringHead];
+        newHeads[i] = {head.x + offset.x, head.y + offset.y};
+
+        dies[i] = newHeads[i].x < 0 || newHeads[i].x >= width ||
+                  newHeads[i].y < 0 || newHeads[i].y >= height ||
+                  owner[newHeads[i].y * width + newHeads[i].x] != 0;
+    }
+
+    // Phase 2: head-to-head — two snakes proposing one cell both die.
+    for (int i = 0; i < snakeCount; ++i)
+        for (int j = i + 1; j < snakeCount; ++j)
+            if (snakes[i].alive && snakes[j].alive && newHeads[i] == newHeads[j])
+                dies[i] = dies[j] = true;
+
+    // Phase 3: move survivors; no two of them target the same cell.
+    bool ateApple = false;
+    for (int i = 0; i < snakeCount; ++i)
+    {
+        ArenaSnake &s = snakes[i];
+        if (!s.alive || dies[i])
+            continue;
+
+        Occupy(newHeads[i], i);
+        s.ringHead = (s.ringHead == 0 ? cells : s.ringHead) - 1;
+        s.body[s.ringHead] = newHeads[i];
+        ++s.length;
+
+        if (newHeads[i] == apple)
+            ateApple = true;
+        else if (s.pendingGrowth > 0)
+            --s.pendingGrowth;
+        else
+        {
+            int tail = s.ringHead + s.length - 1;
+            Vacate(s.body[tail >= cells ? tail - cells : tail]);
+            --s.length;
+        }
+    }
+
+    // Phase 4: clear newly dead snakes off the grid.
+    for (int i = 0; i < snakeCount; ++i)
+    {
+        ArenaSnake &s = snakes[i];
+        if (!s.alive || !dies[i])
+            continue;
+
+        for (int seg = 0; seg < s.length; ++seg)
+            Vacate(Segment(i, seg));
+        s.alive = false;
+        --aliveCount;
+    }
+
+    if (ateApple)
+        apple = NewApplePosition();
+
+    return aliveCount;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file multi_game.h
+ * @brief Multi-snake arena engine sharing one occupancy grid.
+ *
+ * Up to eight snakes play on a single grid. Instead of bolting more
+ * per-snake containers onto Game, the arena keeps one owner grid (a
+ * byte per cell naming the snake occupying it) so every collision
+ * check is an O(1) probe regardless of how many snakes are alive, and
+ * each snake's body ring lives in its own cache-line-aligned slice of
+ * one contiguous slab so per-snake state never false-shares. Per-tick
+ * cost is O(snake count), flat in total body length.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "game.h"
+
+/**
+ * @brief Per-snake state, padded to its own cache line.
+ */
+struct alignas(64) ArenaSnake
+{
+    Direction direction;         /**< Current heading */
+    DirectionQueue queue;        /**< Pending direction intents */
+    Vector2Int *body = nullptr;  /**< Ring storage slice in the shared slab */
+    int ringHead = 0;            /**< Ring index of the head segment */
+    int length = 0;              /**< Live segments */
+    int pendingGrowth = 0;       /**< Tail holds still for this many ticks */
+    bool alive = false;          /**< False once the snake has died */
+};
+
+/**
+ * @brief N-snake match on one grid with single-pass collision resolution.
+ *
+ * All snakes move simultaneously each Step(). A snake dies by hitting
+ * a wall, any cell occupied before the tick (a tail vacating this tick
+ * still counts, matching the single-snake engine), or by proposing the
+ * same cell as another snake — head-to-head kills both. A dead snake's
+ * body is cleared from the grid the same tick.
+ */
+class MultiGame
+{
+public:
+    static constexpr int MAX_SNAKES = 8; /**< Hard snake cap, fits the owner byte */
+
+    /**
+     * @brief Construct a match with snakes at spread spawn points.
+     * @param width Grid width
+     * @param height Grid height
+     * @param snakeCount Snakes in the match, 1 to MAX_SNAKES
+     * @param seed Seed for the apple-spawn PRNG
+     */
+    MultiGame(int width, int height, int snakeCount, std::uint64_t seed);
+
+    /**
+     * @brief Queues a direction intent for one snake.
+     *
+     * Same reversal and pending-cap rules as the single-snake engine.
+     *
+     * @param snake Snake index
+     * @param newDirection Direction to enqueue
+     */
+    void QueueDirection(int snake, Direction newDirection);
+
+    /**
+     * @brief Advances all snakes one tick.
+     * @return Number of snakes still alive
+     */
+    int Step();
+
+    /** @brief Snakes in the match. */
+    int SnakeCount() const { return snakeCount; }
+
+    /** @brief Snakes still alive. */
+    int AliveCount() const { return aliveCount; }
+
+    /** @brief Read access to one snake's state. */
+    const ArenaSnake &Snake(int snake) const { return snakes[snake]; }
+
+    /**
+     * @brief One snake's segment by distance from its head.
+     * @param snake Snake index
+     * @param i Segment index, 0 = head
+     * @return Segment position
+     */
+    const Vector2Int &Segment(int snake, int i) const
+    {
+        const ArenaSnake &s = snakes[snake];
+        int idx = s.ringHead + i;
+        return s.body[idx >= cells ? idx - cells : idx];
+    }
+
+    /**
+     * @brief Snake occupying a cell.
+     * @param x Cell column
+     * @param y Cell row
+     * @return Snake index, or -1 if the cell is empty
+     */
+    int Owner(int x, int y) const { return owner[y * width + x] - 1; }
+
+    int width;         /**< Grid width */
+    int height;        /**< Grid height */
+    Vector2Int apple;  /**< Current apple position */
+
+private:
+    /** @brief Growth granted at spawn and per apple. */
+    static constexpr int START_GROWTH = 2;
+
+    /** @brief Occupies a cell for a snake, updating the free-cell index. */
+    void Occupy(const Vector2Int &pos, int snake);
+
+    /** @brief Frees a cell, updating the free-cell index. */
+    void Vacate(const Vector2Int &pos);
+
+    /** @brief Draws an apple position from the free-cell index. */
+    Vector2Int NewApplePosition();
+
+    int cells;      /**< width * height, ring capacity per snake */
+    int snakeCount; /**< Snakes in the match */
+    int aliveCount; /**< Snakes still alive */
+    std::vector<std::uint8_t> owner;       /**< Per-cell snake index + 1, 0 = empty */
+    std::vector<Vector2Int> freeCells;     /**< Dense array of empty cells */
+    std::vector<int> freeSlot;             /**< freeCells slot per cell, -1 if occupied */
+    std::vector<Vector2Int> slab;          /**< Body ring storage for all snakes */
+    ArenaSnake snakes[MAX_SNAKES];         /**< Per-snake state, one cache line each */
+    Xoshiro256 rng;                        /**< Apple-spawn PRNG */
+};
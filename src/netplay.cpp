@@ -0,0 +1,109 @@
+/**
+ * @file netplay.cpp
+ * @brief Implementation of the lockstep netplay session.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#include "netplay.h"
+
+LockstepSession::LockstepSession(int width, int height, std::uint64_t seed)
+    : local(width, height, Direction::RIGHT, {0, 0}, {}),
+      remote(width, height, Direction::RIGHT, {0, 0}, {}),
+      lastRemoteDirection(Direction::RIGHT)
+{
+    ResetGame(local, seed);
+    ResetGame(remote, seed);
+    // The mirror always carries one snapshot mark at the confirmed
+    // tick; everything journaled past it is prediction.
+    remote.Snapshot();
+    confirmedQueue = remote.directionQueue;
+}
+
+void LockstepSession::Tick(Direction localDirection)
+{
+    QueueDirection(local, localDirection);
+    if (Update(local))
+        ResetGame(local);
+
+    localHistory.push_back(static_cast<std::uint8_t>(localDirection));
+    ++localTick;
+
+    Predict();
+}
+
+void LockstepSession::Predict()
+{
+    if (predictedDead)
+        return;
+
+    for (; predictedTo < localTick; ++predictedTo)
+    {
+        QueueDirection(remote, lastRemoteDirection);
+        if (Update(remote))
+        {
+            // Death is never predicted through: the mirror freezes
+            // here until real input confirms or refutes it.
+            predictedDead = true;
+            return;
+        }
+    }
+}
+
+void LockstepSession::AdvanceConfirmed(Direction direction)
+{
+    QueueDirection(remote, direction);
+    if (Update(remote))
+        ResetGame(remote);
+    ++confirmedTick;
+    lastRemoteDirection = direction;
+}
+
+long LockstepSession::PackOutgoing(long afterTick, std::vector<std::uint8_t> &packed) const
+{
+    long count = localTick - afterTick;
+    if (count <= 0)
+    {
+        packed.clear();
+        return 0;
+    }
+
+    packed.assign((count + 3) / 4, 0);
+    for (long i = 0; i < count; ++i)
+        packed[i >> 2] |= localHistory[afterTick + i] << ((i & 3) * 2);
+    return count;
+}
+
+void LockstepSession::ReceiveRemote(long firstTick, const std::uint8_t *packed, long tickCount)
+{
+    // A gap means a lost packet; the transport resends from our last
+    // acknowledged tick, so just wait for the full run.
+    if (firstTick > confirmedTick + 1)
+        return;
+
+    long lastTick = firstTick + tickCount - 1;
+    if (lastTick <= confirmedTick)
+        return;
+
+    // Drop the prediction, replay the authoritative ticks with the
+    // journal off, then re-mark and re-predict to the local tick.
+    remote.Restore();
+    remote.directionQueue = confirmedQueue;
+    if (predictedTo > confirmedTick || predictedDead)
+        ++rollbacks;
+
+    while (confirmedTick < lastTick)
+    {
+        long i = confirmedTick + 1 - firstTick;
+        auto direction = static_cast<Direction>(packed[i >> 2] >> ((i & 3) * 2) & 3);
+        AdvanceConfirmed(direction);
+        ++resimulated;
+    }
+
+    remote.Snapshot();
+    confirmedQueue = remote.directionQueue;
+    predictedTo = confirmedTick;
+    predictedDead = false;
+    Predict();
+}
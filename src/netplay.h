@@ -0,0 +1,118 @@
+/**
+ * @file netplay.h
+ * @brief Deterministic lockstep session with rollback resimulation.
+ *
+ * Head-to-head play runs both cabinets' games on every cabinet: the
+ * local game advances with authoritative local input, and a mirror of
+ * the opponent's game advances with their received intents. Only one
+ * 2-bit heading per tick crosses the wire — Update() is a pure
+ * function of the queued directions once the PRNG is seeded, so that
+ * is the entire shared state. When the opponent's intents are late the
+ * mirror predicts on their last known heading past a Snapshot() mark;
+ * when the real intents arrive the mirror Restore()s to the confirmed
+ * tick and resimulates, which the snapshot journal makes cheap enough
+ * for thousands of ticks per frame. The session is transport-agnostic:
+ * it packs and accepts intent runs and leaves delivery to the caller.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "game.h"
+
+/**
+ * @brief One peer's view of a two-cabinet lockstep match.
+ */
+class LockstepSession
+{
+public:
+    /**
+     * @brief Construct a session; both peers must use the same arguments.
+     * @param width Grid width
+     * @param height Grid height
+     * @param seed Shared seed for both games' PRNG streams
+     */
+    LockstepSession(int width, int height, std::uint64_t seed);
+
+    /**
+     * @brief Advances the local game one tick and re-targets the mirror.
+     *
+     * The local heading is recorded for transmission; the remote
+     * mirror is predicted forward so both games render at the same
+     * tick.
+     *
+     * @param localDirection Local player's commanded heading this tick
+     */
+    void Tick(Direction localDirection);
+
+    /**
+     * @brief Packs local headings after a tick for the transport.
+     *
+     * Headings are packed four per byte, oldest first, in the same
+     * 2-bit encoding the recording format uses. The caller resends
+     * from the peer's last acknowledged tick; duplicates are safe.
+     *
+     * @param afterTick Pack headings for ticks greater than this
+     * @param packed Receives the packed bytes
+     * @return Number of ticks packed
+     */
+    long PackOutgoing(long afterTick, std::vector<std::uint8_t> &packed) const;
+
+    /**
+     * @brief Feeds a run of the opponent's headings into the mirror.
+     *
+     * Ticks at or before the confirmed frontier are ignored, so
+     * redundant retransmission is harmless. Arrivals past the frontier
+     * roll the mirror back and resimulate.
+     *
+     * @param firstTick Tick of the first packed heading
+     * @param packed Headings packed four per byte, oldest first
+     * @param tickCount Number of headings in packed
+     */
+    void ReceiveRemote(long firstTick, const std::uint8_t *packed, long tickCount);
+
+    /** @brief Authoritative local game. */
+    const Game &LocalGame() const { return local; }
+
+    /** @brief Opponent mirror, predicted up to the local tick. */
+    const Game &RemoteGame() const { return remote; }
+
+    /** @brief Ticks the local game has advanced. */
+    long LocalTick() const { return localTick; }
+
+    /** @brief Highest remote tick simulated from real, not predicted, input. */
+    long ConfirmedRemoteTick() const { return confirmedTick; }
+
+    /** @brief Rollbacks performed so far. */
+    long Rollbacks() const { return rollbacks; }
+
+    /** @brief Ticks resimulated across all rollbacks. */
+    long ResimulatedTicks() const { return resimulated; }
+
+private:
+    /** @brief Advances the mirror one authoritative tick. */
+    void AdvanceConfirmed(Direction direction);
+
+    /** @brief Re-predicts the mirror from the confirmed mark to localTick. */
+    void Predict();
+
+    Game local;   /**< This cabinet's game, authoritative */
+    Game remote;  /**< Opponent's game, confirmed + predicted */
+    long localTick = 0;     /**< Ticks advanced locally */
+    long confirmedTick = 0; /**< Remote ticks backed by received input */
+    long predictedTo = 0;   /**< Remote ticks including prediction */
+    bool predictedDead = false;       /**< Prediction hit a death; mirror frozen */
+    Direction lastRemoteDirection;    /**< Latest authoritative remote heading */
+    DirectionQueue confirmedQueue;    /**< Mirror's pending queue at the mark; the
+                                           journal can't undo prediction's own
+                                           QueueDirection pushes, so rollback
+                                           reinstates it by hand */
+    std::vector<std::uint8_t> localHistory; /**< Local heading per tick, for packing */
+    long rollbacks = 0;     /**< Rollback count, for stats overlays */
+    long resimulated = 0;   /**< Total authoritative ticks replayed */
+};
@@ -0,0 +1,59 @@
+/**
+ * @file overlay.cpp
+ * @brief Implementation of the on-screen timing overlay.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#include "overlay.h"
+
+#include <raylib.h>
+
+constexpr int OVERLAY_WIDTH = 250;   /**< Overlay panel width in pixels */
+constexpr int OVERLAY_HEIGHT = 110;  /**< Overlay panel height in pixels */
+constexpr int PLOT_HEIGHT = 40;      /**< Frame-time plot height in pixels */
+constexpr float PLOT_CEILING = 1.0f / 30.0f; /**< Frame time drawn at full plot height */
+
+/**
+ * @brief Formats a nanosecond value as a compact ms/us string.
+ * @param ns Duration in nanoseconds
+ * @return Static-buffer string, valid until the next call
+ */
+static const char *FormatNs(std::uint64_t ns)
+{
+    if (ns >= 1'000'000)
+        return TextFormat("%.2fms", ns / 1e6);
+    return TextFormat("%.1fus", ns / 1e3);
+}
+
+void DrawStatsOverlay(const FrameStats &stats)
+{
+    DrawRectangle(5, 5, OVERLAY_WIDTH, OVERLAY_HEIGHT, Color{0, 0, 0, 170});
+
+    DrawText(TextFormat("update p50 %s  p99 %s  max %s",
+                        FormatNs(stats.updateTime.Percentile(0.50)),
+                        FormatNs(stats.updateTime.Percentile(0.99)),
+                        FormatNs(stats.updateTime.Max())),
+             12, 12, 10, GREEN);
+    DrawText(TextFormat("render p50 %s  p99 %s  max %s",
+                        FormatNs(stats.renderTime.Percentile(0.50)),
+                        FormatNs(stats.renderTime.Percentile(0.99)),
+                        FormatNs(stats.renderTime.Max())),
+             12, 26, 10, SKYBLUE);
+
+    // One bar per recent frame, oldest first; 30 FPS pegs the plot top.
+    int plotTop = OVERLAY_HEIGHT - PLOT_HEIGHT;
+    float barWidth = static_cast<float>(OVERLAY_WIDTH - 14) / FrameStats::PLOT_FRAMES;
+    for (int i = 0; i < FrameStats::PLOT_FRAMES; ++i)
+    {
+        float frameTime = stats.frameTimes[(stats.frameCursor + i) % FrameStats::PLOT_FRAMES];
+        float height = frameTime / PLOT_CEILING * PLOT_HEIGHT;
+        height = height > PLOT_HEIGHT ? PLOT_HEIGHT : height;
+        Color color = frameTime > 1.0f / 55.0f ? ORANGE : GREEN;
+        DrawRectangle(12 + static_cast<int>(i * barWidth),
+                      plotTop + PLOT_HEIGHT - static_cast<int>(height),
+                      static_cast<int>(barWidth) > 1 ? static_cast<int>(barWidth) : 1,
+                      static_cast<int>(height), color);
+    }
+}
@@ -0,0 +1,21 @@
+/**
+ * @file overlay.h
+ * @brief On-screen timing overlay for the instrumentation histograms.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include "instrumentation.h"
+
+/**
+ * @brief Draws the timing overlay in the top-left corner.
+ *
+ * Shows p50/p99/max for update and render plus a bar plot of recent
+ * frame times. Call between BeginDrawing() and EndDrawing().
+ *
+ * @param stats Captured frame statistics
+ */
+void DrawStatsOverlay(const FrameStats &stats);
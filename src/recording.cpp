@@ -0,0 +1,113 @@
+/**
+ * @file recording.cpp
+ * @brief Implementation of binary recording capture and mmap replay.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#include "recording.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+void GameRecorder::Begin(int width, int height, std::uint64_t seed)
+{
+    header = RecordingHeader{{'S', 'N', 'K', 'R'}, 1,
+                             width, height, seed, 0};
+    moves.clear();
+    moveCount = 0;
+}
+
+void GameRecorder::RecordTick(Direction direction)
+{
+    if ((moveCount & 3) == 0)
+        moves.push_back(0);
+    moves.back() |= static_cast<std::uint8_t>(direction) << ((moveCount & 3) * 2);
+    ++moveCount;
+}
+
+bool GameRecorder::Save(const char *path) const
+{
+    std::FILE *file = std::fopen(path, "wb");
+    if (!file)
+        return false;
+
+    RecordingHeader out = header;
+    out.moveCount = static_cast<std::uint64_t>(moveCount);
+
+    bool ok = std::fwrite(&out, sizeof(out), 1, file) == 1 &&
+              (moves.empty() || std::fwrite(moves.data(), moves.size(), 1, file) == 1);
+    ok = std::fclose(file) == 0 && ok;
+    return ok;
+}
+
+bool GameReplay::Open(const char *path)
+{
+    Close();
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info{};
+    if (fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(RecordingHeader))
+    {
+        close(fd);
+        return false;
+    }
+
+    mappingSize = static_cast<std::size_t>(info.st_size);
+    mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        mapping = nullptr;
+        return false;
+    }
+
+    header = static_cast<const RecordingHeader *>(mapping);
+    moves = static_cast<const std::uint8_t *>(mapping) + sizeof(RecordingHeader);
+
+    // Grid bounds guard downstream Game construction: non-positive
+    // dimensions would carve empty arena spans, and the cap keeps
+    // width * height well inside int range for a corrupt header.
+    constexpr std::int32_t MAX_DIMENSION = 1 << 15;
+    bool valid = std::memcmp(header->magic, "SNKR", 4) == 0 &&
+                 header->version == 1 &&
+                 header->width > 0 && header->width <= MAX_DIMENSION &&
+                 header->height > 0 && header->height <= MAX_DIMENSION &&
+                 mappingSize >= sizeof(RecordingHeader) + (header->moveCount + 3) / 4;
+    if (!valid)
+        Close();
+    return valid;
+}
+
+void GameReplay::Close()
+{
+    if (mapping)
+        munmap(mapping, mappingSize);
+    mapping = nullptr;
+    header = nullptr;
+    moves = nullptr;
+    mappingSize = 0;
+}
+
+long ReplayIntoGame(const GameReplay &replay, Game &game)
+{
+    ResetGame(game, replay.Seed());
+
+    long moveCount = replay.MoveCount();
+    for (long move = 0; move < moveCount; ++move)
+    {
+        game.direction = replay.Move(move);
+        if (Update(game))
+            return move + 1;
+    }
+    return moveCount;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file render_state.h
+ * @brief Immutable render snapshots and a lock-free triple buffer.
+ *
+ * Decouples simulation from rendering across threads: the simulation
+ * thread captures a snapshot of renderable state (segments, apple,
+ * grid size) after each tick and publishes it with one atomic
+ * exchange; the render thread acquires the newest snapshot the same
+ * way. Neither side ever blocks, and a slow consumer only means
+ * skipped snapshots, never a stalled producer. Raylib owns the GL
+ * context on the main thread, so it is the simulation that moves off
+ * the main thread, not the renderer.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "game.h"
+
+/**
+ * @brief Everything the renderer needs to draw one frame.
+ */
+struct RenderSnapshot
+{
+    int width = 0;                    /**< Grid width */
+    int height = 0;                   /**< Grid height */
+    std::vector<Vector2Int> segments; /**< Snake body, head first */
+    Vector2Int apple{};               /**< Apple position */
+};
+
+/**
+ * @brief Copies a game's renderable state into a snapshot.
+ *
+ * Reuses the snapshot's segment storage, so steady-state capture does
+ * not allocate.
+ *
+ * @param game Game to capture
+ * @param snapshot Snapshot to fill
+ */
+inline void CaptureRenderSnapshot(const Game &game, RenderSnapshot &snapshot)
+{
+    snapshot.width = game.width;
+    snapshot.height = game.height;
+    snapshot.apple = game.apple;
+    snapshot.segments.resize(game.snake.size());
+    for (int i = 0; i < game.snake.size(); ++i)
+        snapshot.segments[i] = game.snake[i];
+}
+
+/**
+ * @brief Single-producer single-consumer lock-free triple buffer.
+ *
+ * The producer fills Write() and calls Publish(); the consumer calls
+ * Acquire() and, when it returns true, reads the new snapshot via
+ * Read(). Hand-off is a single atomic exchange on the spare slot.
+ */
+class TripleBuffer
+{
+public:
+    /** @brief Slot the producer may fill; owned until Publish(). */
+    RenderSnapshot &Write() { return buffers[writeIdx]; }
+
+    /** @brief Publishes the written slot and takes the spare. */
+    void Publish()
+    {
+        writeIdx = middle.exchange(writeIdx | DIRTY_BIT, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    /**
+     * @brief Takes the newest published snapshot if there is one.
+     * @return True if Read() now returns a fresh snapshot
+     */
+    bool Acquire()
+    {
+        if (!(middle.load(std::memory_order_acquire) & DIRTY_BIT))
+            return false;
+        readIdx = middle.exchange(readIdx, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+
+    /** @brief Most recently acquired snapshot; owned until the next Acquire(). */
+    const RenderSnapshot &Read() const { return buffers[readIdx]; }
+
+private:
+    static constexpr int DIRTY_BIT = 4;  /**< Set on middle when it holds fresh data */
+    static constexpr int INDEX_MASK = 3; /**< Extracts the slot index */
+
+    RenderSnapshot buffers[3];    /**< The three snapshot slots */
+    int writeIdx = 0;             /**< Producer-owned slot */
+    int readIdx = 1;              /**< Consumer-owned slot */
+    std::atomic<int> middle{2};   /**< Spare slot, plus dirty flag */
+};
@@ -0,0 +1,335 @@
+/**
+ * @file renderer.cpp
+ * @brief Implementation of the dirty-cell canvas renderer.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#include "renderer.h"
+
+#include <algorithm>
+#include <rlgl.h>
+
+constexpr int BORDER_THICKNESS = 2;      /**< Border thickness around the game grid */
+const Color SNAKE_HEAD_COLOR{71, 130, 255, 255}; /**< Base snake head color */
+const Color BORDER_COLOR{0, 0, 0, 255};          /**< Border color */
+const Color BORDER_BG{160, 255, 112, 255};      /**< Background behind the border */
+
+namespace
+{
+
+/**
+ * @brief Emits cell quads directly into one rlgl vertex batch.
+ *
+ * Avoids a DrawRectangle dispatch (with its own rlBegin/rlEnd) per
+ * cell; all quads between Begin() and End() go out in a single batch
+ * submission, flushed in chunks only if the batch buffer fills up.
+ */
+class CellBatch
+{
+public:
+    /** @brief Opens the quad batch. */
+    void Begin()
+    {
+        rlSetTexture(rlGetTextureIdDefault());
+        rlBegin(RL_QUADS);
+    }
+
+    /**
+     * @brief Appends one solid cell quad to the batch.
+     * @param x Left edge in pixels
+     * @param y Top edge in pixels
+     * @param size Cell size in pixels
+     * @param color Fill color
+     */
+    void Quad(int x, int y, int size, Color color)
+    {
+        if (++quads > FLUSH_QUADS)
+        {
+            rlEnd();
+            rlDrawRenderBatchActive();
+            rlBegin(RL_QUADS);
+            quads = 1;
+        }
+
+        auto left = static_cast<float>(x);
+        auto top = static_cast<float>(y);
+        auto right = static_cast<float>(x + size);
+        auto bottom = static_cast<float>(y + size);
+
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        rlTexCoord2f(0.0f, 0.0f); rlVertex2f(left, top);
+        rlTexCoord2f(0.0f, 1.0f); rlVertex2f(left, bottom);
+        rlTexCoord2f(1.0f, 1.0f); rlVertex2f(right, bottom);
+        rlTexCoord2f(1.0f, 0.0f); rlVertex2f(right, top);
+    }
+
+    /** @brief Closes the quad batch. */
+    void End()
+    {
+        rlEnd();
+        rlSetTexture(0);
+    }
+
+private:
+    /** @brief Quads per chunk, kept safely under the rlgl batch element limit. */
+    static constexpr int FLUSH_QUADS = 4096;
+
+    int quads = 0; /**< Quads emitted in the current chunk */
+};
+
+} // namespace
+
+int GetCellSize(int gameWidth, int gameHeight, int screenWidth, int screenHeight)
+{
+    int cellWidth = (screenWidth - BORDER_THICKNESS * 2) / gameWidth;
+    int cellHeight = (screenHeight - BORDER_THICKNESS * 2) / gameHeight;
+    return std::min(cellWidth, cellHeight);
+}
+
+void Renderer::RebuildGradientLut(int snakeLength)
+{
+    for (int bucket = 0; bucket <= GRADIENT_STEPS; ++bucket)
+    {
+        int factor = bucket * 255 / GRADIENT_STEPS;
+        bucketColors[bucket] = {
+            static_cast<unsigned char>(SNAKE_HEAD_COLOR.r * factor / 255),
+            static_cast<unsigned char>(SNAKE_HEAD_COLOR.g * factor / 255),
+            static_cast<unsigned char>(SNAKE_HEAD_COLOR.b * factor / 255),
+            255
+        };
+    }
+
+    bucketOfIndex.resize(snakeLength);
+    for (int i = 0; i < snakeLength; ++i)
+        bucketOfIndex[i] = static_cast<std::uint16_t>((snakeLength - i) * GRADIENT_STEPS / snakeLength);
+    lutLength = snakeLength;
+}
+
+void Renderer::RebuildStaticLayer(int gridWidth, int gridHeight)
+{
+    if (staticLayer.id == 0)
+        staticLayer = LoadRenderTexture(screenWidth, screenHeight);
+
+    BeginTextureMode(staticLayer);
+    ClearBackground(RAYWHITE);
+
+    int gameWidthPx = cellSize * gridWidth;
+    int gameHeightPx = cellSize * gridHeight;
+
+    DrawRectangle(offsetX - BORDER_THICKNESS, offsetY - BORDER_THICKNESS,
+                gameWidthPx + BORDER_THICKNESS * 2, gameHeightPx + BORDER_THICKNESS * 2,
+                BORDER_BG);
+
+    DrawRectangleLinesEx(
+        Rectangle{static_cast<float>(offsetX - BORDER_THICKNESS), static_cast<float>(offsetY - BORDER_THICKNESS),
+                static_cast<float>(gameWidthPx + BORDER_THICKNESS * 2), static_cast<float>(gameHeightPx + BORDER_THICKNESS * 2)},
+        static_cast<float>(BORDER_THICKNESS), BORDER_COLOR);
+
+    DrawRectangle(offsetX, offsetY, gameWidthPx, gameHeightPx, RAYWHITE);
+
+    if (gridLines)
+    {
+        Color lineColor{0, 0, 0, 24};
+        for (int x = 1; x < gridWidth; ++x)
+            DrawRectangle(pixelX[x], offsetY, 1, gameHeightPx, lineColor);
+        for (int y = 1; y < gridHeight; ++y)
+            DrawRectangle(offsetX, pixelY[y], gameWidthPx, 1, lineColor);
+    }
+
+    EndTextureMode();
+    staticStale = false;
+}
+
+void Renderer::RepaintStatic(int gridWidth, int gridHeight)
+{
+    // Blit the cached static scenery instead of re-issuing its draw calls.
+    DrawTextureRec(staticLayer.texture,
+                Rectangle{0.0f, 0.0f, static_cast<float>(screenWidth), static_cast<float>(-screenHeight)},
+                Vector2{0.0f, 0.0f}, WHITE);
+
+    lastCell.assign(gridWidth * gridHeight, CELL_EMPTY);
+}
+
+bool Renderer::SyncScreenSize(int gridWidth, int gridHeight, int newScreenWidth, int newScreenHeight)
+{
+    bool fullRepaint = false;
+    bool layoutStale = false;
+
+    if (newScreenWidth != screenWidth || newScreenHeight != screenHeight || canvas.id == 0)
+    {
+        Unload();
+        canvas = LoadRenderTexture(newScreenWidth, newScreenHeight);
+        screenWidth = newScreenWidth;
+        screenHeight = newScreenHeight;
+        layoutStale = true;
+    }
+
+    // A board resize invalidates the layout too: the pixel-edge tables
+    // are per-column/row, so a grown grid would index past them and a
+    // shrunk one would keep the old cell size and centering.
+    if (layoutStale || gridWidth != static_cast<int>(pixelX.size()) ||
+        gridHeight != static_cast<int>(pixelY.size()))
+    {
+        cellSize = GetCellSize(gridWidth, gridHeight, screenWidth, screenHeight);
+        offsetX = (screenWidth - cellSize * gridWidth) / 2;
+        offsetY = (screenHeight - cellSize * gridHeight) / 2;
+
+        pixelX.resize(gridWidth);
+        for (int x = 0; x < gridWidth; ++x)
+            pixelX[x] = offsetX + x * cellSize;
+        pixelY.resize(gridHeight);
+        for (int y = 0; y < gridHeight; ++y)
+            pixelY[y] = offsetY + y * cellSize;
+        staticStale = true;
+        fullRepaint = true;
+    }
+
+    if (staticLayer.id == 0 || staticStale)
+    {
+        RebuildStaticLayer(gridWidth, gridHeight);
+        fullRepaint = true;
+    }
+
+    return fullRepaint;
+}
+
+void Renderer::Prewarm(int gridWidth, int gridHeight, int screenWidth, int screenHeight,
+                       int snakeLength)
+{
+    RebuildGradientLut(snakeLength);
+    SyncScreenSize(gridWidth, gridHeight, screenWidth, screenHeight);
+    BeginTextureMode(canvas);
+    RepaintStatic(gridWidth, gridHeight);
+    EndTextureMode();
+}
+
+void Renderer::SetGridLines(bool enabled)
+{
+    if (gridLines != enabled)
+    {
+        gridLines = enabled;
+        staticStale = true;
+    }
+}
+
+void Renderer::UpdateCanvas(Game &game, int newScreenWidth, int newScreenHeight)
+{
+    bool fullRepaint = SyncScreenSize(game.width, game.height, newScreenWidth, newScreenHeight) ||
+                       game.boardDirty;
+
+    BeginTextureMode(canvas);
+
+    if (fullRepaint)
+    {
+        RepaintStatic(game.width, game.height);
+        game.boardDirty = false;
+        game.vacatedCells.clear();
+    }
+
+    int snakeLength = game.snake.size();
+    if (snakeLength != lutLength)
+        RebuildGradientLut(snakeLength);
+
+    CellBatch batch;
+    batch.Begin();
+
+    for (const auto &cell : game.vacatedCells)
+    {
+        batch.Quad(pixelX[cell.x], pixelY[cell.y], cellSize, RAYWHITE);
+        lastCell[cell.y * game.width + cell.x] = CELL_EMPTY;
+    }
+    game.vacatedCells.clear();
+
+    int appleCell = game.apple.y * game.width + game.apple.x;
+    if (lastCell[appleCell] != CELL_APPLE)
+    {
+        batch.Quad(pixelX[game.apple.x], pixelY[game.apple.y], cellSize, RED);
+        lastCell[appleCell] = CELL_APPLE;
+    }
+
+    for (int i = 0; i < snakeLength; ++i)
+    {
+        const auto &coord = game.snake[i];
+        auto desired = static_cast<std::uint16_t>(CELL_SNAKE + bucketOfIndex[i]);
+
+        std::uint16_t &drawn = lastCell[coord.y * game.width + coord.x];
+        if (drawn == desired)
+            continue;
+
+        batch.Quad(pixelX[coord.x], pixelY[coord.y], cellSize, bucketColors[bucketOfIndex[i]]);
+        drawn = desired;
+    }
+
+    batch.End();
+    EndTextureMode();
+}
+
+void Renderer::UpdateCanvas(const RenderSnapshot &snapshot, int newScreenWidth, int newScreenHeight)
+{
+    bool fullRepaint = SyncScreenSize(snapshot.width, snapshot.height,
+                                      newScreenWidth, newScreenHeight);
+
+    BeginTextureMode(canvas);
+
+    if (fullRepaint)
+        RepaintStatic(snapshot.width, snapshot.height);
+
+    int snakeLength = static_cast<int>(snapshot.segments.size());
+    if (snakeLength != lutLength)
+        RebuildGradientLut(snakeLength);
+
+    // No dirty list from the live game here, so diff the snapshot against
+    // the per-cell cache instead; draws still cover only changed cells.
+    desiredCell.assign(snapshot.width * snapshot.height, CELL_EMPTY);
+    desiredCell[snapshot.apple.y * snapshot.width + snapshot.apple.x] = CELL_APPLE;
+    for (int i = snakeLength - 1; i >= 0; --i)
+    {
+        const auto &coord = snapshot.segments[i];
+        desiredCell[coord.y * snapshot.width + coord.x] =
+            static_cast<std::uint16_t>(CELL_SNAKE + bucketOfIndex[i]);
+    }
+
+    CellBatch batch;
+    batch.Begin();
+
+    for (int cell = 0; cell < static_cast<int>(desiredCell.size()); ++cell)
+    {
+        if (desiredCell[cell] == lastCell[cell])
+            continue;
+
+        int x = cell % snapshot.width;
+        int y = cell / snapshot.width;
+        Color color = desiredCell[cell] == CELL_EMPTY ? RAYWHITE
+                    : desiredCell[cell] == CELL_APPLE ? RED
+                    : bucketColors[desiredCell[cell] - CELL_SNAKE];
+        batch.Quad(pixelX[x], pixelY[y], cellSize, color);
+        lastCell[cell] = desiredCell[cell];
+    }
+
+    batch.End();
+    EndTextureMode();
+}
+
+void Renderer::Present() const
+{
+    // Render textures are stored bottom-up, so blit with a flipped source rect.
+    DrawTextureRec(canvas.texture,
+                Rectangle{0.0f, 0.0f, static_cast<float>(screenWidth), static_cast<float>(-screenHeight)},
+                Vector2{0.0f, 0.0f}, WHITE);
+}
+
+void Renderer::Unload()
+{
+    if (canvas.id != 0)
+    {
+        UnloadRenderTexture(canvas);
+        canvas = RenderTexture2D{};
+    }
+    if (staticLayer.id != 0)
+    {
+        UnloadRenderTexture(staticLayer);
+        staticLayer = RenderTexture2D{};
+    }
+}
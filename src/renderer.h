@@ -0,0 +1,146 @@
+/**
+ * @file renderer.h
+ * @brief Dirty-cell renderer drawing the game into a cached canvas.
+ *
+ * Instead of redrawing the border, apple, and every snake segment each
+ * frame, the renderer keeps the scene in a RenderTexture2D canvas and
+ * repaints only the cells that changed since the previous frame. The
+ * length gradient is quantized into buckets so a move only recolors the
+ * handful of segments that cross a bucket boundary, not the whole body.
+ * A full repaint happens only on window resize or game reset. Cell
+ * layout (cell size, origin, per-row and per-column pixel edges) is
+ * precomputed per window size, so positioning a cell is two table
+ * lookups rather than per-segment multiply-add math.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <raylib.h>
+#include <vector>
+
+#include "game.h"
+#include "render_state.h"
+
+/**
+ * @brief Calculates the size of a single grid cell.
+ * @param gameWidth Number of cells horizontally
+ * @param gameHeight Number of cells vertically
+ * @param screenWidth Screen width in pixels
+ * @param screenHeight Screen height in pixels
+ * @return Cell size in pixels
+ */
+int GetCellSize(int gameWidth, int gameHeight, int screenWidth, int screenHeight);
+
+/**
+ * @brief Incremental renderer with a per-cell change cache.
+ *
+ * Owns a screen-sized canvas texture and a record of what each board
+ * cell last looked like, redrawing a cell only when its contents
+ * change.
+ */
+class Renderer
+{
+public:
+    /**
+     * @brief Updates the canvas with everything that changed this frame.
+     *
+     * Must be called outside BeginDrawing()/EndDrawing(); drains the
+     * game's dirty-cell list.
+     *
+     * @param game Game state to draw
+     * @param screenWidth Current screen width in pixels
+     * @param screenHeight Current screen height in pixels
+     */
+    void UpdateCanvas(Game &game, int screenWidth, int screenHeight);
+
+    /**
+     * @brief Updates the canvas from an immutable snapshot.
+     *
+     * Used by the threaded simulation mode, where the renderer never
+     * touches the live Game. Changed cells are found by diffing the
+     * snapshot against the per-cell cache, so the draw cost is still
+     * proportional to what changed.
+     *
+     * @param snapshot Snapshot to draw
+     * @param screenWidth Current screen width in pixels
+     * @param screenHeight Current screen height in pixels
+     */
+    void UpdateCanvas(const RenderSnapshot &snapshot, int screenWidth, int screenHeight);
+
+    /**
+     * @brief Builds every cacheable resource before the first frame.
+     *
+     * Call once after InitWindow(): allocates the canvas and static
+     * layer, paints the background, and fills the gradient and layout
+     * tables, so the first real frame starts from a warm cache
+     * instead of paying the one-time setup inside the game loop.
+     *
+     * @param gridWidth Number of cells horizontally
+     * @param gridHeight Number of cells vertically
+     * @param screenWidth Current screen width in pixels
+     * @param screenHeight Current screen height in pixels
+     * @param snakeLength Starting snake length for the gradient table
+     */
+    void Prewarm(int gridWidth, int gridHeight, int screenWidth, int screenHeight, int snakeLength);
+
+    /**
+     * @brief Blits the cached canvas to the screen.
+     *
+     * Call between BeginDrawing() and EndDrawing().
+     */
+    void Present() const;
+
+    /**
+     * @brief Enables or disables the grid-line layer in the static cache.
+     * @param enabled True to draw cell grid lines
+     */
+    void SetGridLines(bool enabled);
+
+    /**
+     * @brief Releases the canvas and static-layer textures.
+     */
+    void Unload();
+
+private:
+    /** @brief Per-cell content codes stored in the change cache. */
+    static constexpr std::uint16_t CELL_EMPTY = 0; /**< Cell is background */
+    static constexpr std::uint16_t CELL_APPLE = 1; /**< Cell holds the apple */
+    // Values >= CELL_SNAKE encode CELL_SNAKE + gradient bucket.
+    static constexpr std::uint16_t CELL_SNAKE = 2; /**< First snake bucket code */
+
+    /** @brief Number of quantized gradient shades along the snake. */
+    static constexpr int GRADIENT_STEPS = 64;
+
+    /** @brief Re-renders the static layer (background, border, grid lines). */
+    void RebuildStaticLayer(int gridWidth, int gridHeight);
+
+    /** @brief Repaints the canvas from the static layer and resets the cache. */
+    void RepaintStatic(int gridWidth, int gridHeight);
+
+    /** @brief Recomputes layout and textures when the screen size changes. */
+    bool SyncScreenSize(int gridWidth, int gridHeight, int newScreenWidth, int newScreenHeight);
+
+    /** @brief Rebuilds the per-index gradient bucket table for a snake length. */
+    void RebuildGradientLut(int snakeLength);
+
+    RenderTexture2D canvas{};       /**< Cached scene, screen sized */
+    RenderTexture2D staticLayer{};  /**< Background, border, and grid lines */
+    bool gridLines = false;         /**< Grid-line layer enabled */
+    bool staticStale = false;       /**< Static layer needs a re-render */
+    int screenWidth = 0;            /**< Canvas width in pixels */
+    int screenHeight = 0;           /**< Canvas height in pixels */
+    int cellSize = 0;               /**< Cached cell size in pixels */
+    int offsetX = 0;                /**< Cached grid origin X in pixels */
+    int offsetY = 0;                /**< Cached grid origin Y in pixels */
+    std::vector<int> pixelX;        /**< Left pixel edge per grid column */
+    std::vector<int> pixelY;        /**< Top pixel edge per grid row */
+    std::vector<std::uint16_t> lastCell; /**< Last drawn content per board cell */
+    std::vector<std::uint16_t> desiredCell; /**< Scratch codes for snapshot diffing */
+    Color bucketColors[GRADIENT_STEPS + 1]{}; /**< Gradient shade per bucket */
+    std::vector<std::uint16_t> bucketOfIndex; /**< Gradient bucket per segment index */
+    int lutLength = 0;              /**< Snake length bucketOfIndex was built for */
+};
@@ -0,0 +1,90 @@
+/**
+ * @file rng.h
+ * @brief Small, fast, seedable PRNG for the simulation hot path.
+ *
+ * Replaces per-call std::random_device + std::mt19937 construction:
+ * a xoshiro256++ generator is a few nanoseconds per draw and makes
+ * whole games deterministically replayable from one seed.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief xoshiro256++ pseudo-random generator.
+ *
+ * State is expanded from a 64-bit seed with splitmix64, so any seed
+ * (including 0) produces a well-mixed stream.
+ */
+class Xoshiro256
+{
+public:
+    /**
+     * @brief Construct and seed the generator.
+     * @param seed 64-bit seed value
+     */
+    explicit Xoshiro256(std::uint64_t seed = 0) { Seed(seed); }
+
+    /**
+     * @brief Re-seeds the generator, restarting its stream.
+     * @param seed 64-bit seed value
+     */
+    void Seed(std::uint64_t seed)
+    {
+        for (auto &word : state)
+        {
+            seed += 0x9E3779B97F4A7C15ULL;
+            std::uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    /**
+     * @brief Draws the next 64-bit value.
+     * @return Uniformly distributed 64-bit value
+     */
+    std::uint64_t Next()
+    {
+        std::uint64_t result = Rotl(state[0] + state[3], 23) + state[0];
+        std::uint64_t t = state[1] << 17;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = Rotl(state[3], 45);
+
+        return result;
+    }
+
+    /**
+     * @brief Draws a value in [0, bound) via multiply-shift reduction.
+     *
+     * The tiny modulo bias is far below anything observable at
+     * board-sized bounds.
+     *
+     * @param bound Exclusive upper bound, must be > 0
+     * @return Value in [0, bound)
+     */
+    std::uint64_t NextBelow(std::uint64_t bound)
+    {
+        return static_cast<std::uint64_t>(
+            (static_cast<unsigned __int128>(Next()) * bound) >> 64);
+    }
+
+private:
+    /** @brief Rotates x left by k bits. */
+    static std::uint64_t Rotl(std::uint64_t x, int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    std::uint64_t state[4]; /**< xoshiro256++ state words */
+};
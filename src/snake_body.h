@@ -0,0 +1,114 @@
+/**
+ * @file snake_body.h
+ * @brief Fixed-capacity ring buffer for snake body storage.
+ *
+ * The snake only ever grows at the front and shrinks at the back, so a
+ * contiguous ring buffer sized to the grid replaces std::deque: no
+ * per-move allocation, and a cache-friendly linear walk for rendering
+ * and scans.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include <initializer_list>
+#include <span>
+
+#include "types.h"
+
+/**
+ * @brief Contiguous ring buffer of snake segments, front = head.
+ *
+ * Capacity is fixed at construction (the grid's cell count), which the
+ * snake can never exceed, so pushes and pops never allocate. The
+ * storage itself lives in the owning game's arena.
+ */
+class SnakeBody
+{
+public:
+    SnakeBody() = default;
+
+    /**
+     * @brief Construct an empty body over the given storage.
+     * @param storage Segment storage; capacity is its extent (grid cell count)
+     */
+    explicit SnakeBody(std::span<Vector2Int> storage) : buffer(storage) {}
+
+    /**
+     * @brief Replaces the body with the given segments, head first.
+     *
+     * Keeps the existing capacity; used when resetting a game.
+     *
+     * @param segments New body, ordered head to tail
+     * @return Reference to this body
+     */
+    SnakeBody &operator=(std::initializer_list<Vector2Int> segments)
+    {
+        head = 0;
+        length = 0;
+        for (const auto &segment : segments)
+            buffer[length++] = segment;
+        return *this;
+    }
+
+    /**
+     * @brief Prepends a new head segment.
+     * @param segment New head position
+     */
+    void push_front(const Vector2Int &segment)
+    {
+        head = head == 0 ? static_cast<int>(buffer.size()) - 1 : head - 1;
+        buffer[head] = segment;
+        ++length;
+    }
+
+    /** @brief Removes the tail segment. */
+    void pop_back() { --length; }
+
+    /**
+     * @brief Re-appends a tail segment; used by snapshot rollback.
+     * @param segment Tail position to restore
+     */
+    void push_back(const Vector2Int &segment)
+    {
+        int idx = head + length;
+        int capacity = static_cast<int>(buffer.size());
+        buffer[idx >= capacity ? idx - capacity : idx] = segment;
+        ++length;
+    }
+
+    /** @brief Removes the head segment; used by snapshot rollback. */
+    void pop_front()
+    {
+        head = head + 1 == static_cast<int>(buffer.size()) ? 0 : head + 1;
+        --length;
+    }
+
+    /** @brief Current head position. */
+    const Vector2Int &front() const { return buffer[head]; }
+
+    /** @brief Current tail position. */
+    const Vector2Int &back() const { return (*this)[length - 1]; }
+
+    /**
+     * @brief Segment access by distance from the head.
+     * @param i Index, 0 = head
+     * @return Segment position
+     */
+    const Vector2Int &operator[](int i) const
+    {
+        int idx = head + i;
+        int capacity = static_cast<int>(buffer.size());
+        return buffer[idx >= capacity ? idx - capacity : idx];
+    }
+
+    /** @brief Number of segments. */
+    int size() const { return length; }
+
+private:
+    std::span<Vector2Int> buffer; /**< Segment storage, wraps around */
+    int head = 0;                   /**< Buffer index of the head segment */
+    int length = 0;                 /**< Number of live segments */
+};
@@ -0,0 +1,209 @@
+/**
+ * @file static_game.h
+ * @brief Compile-time-sized simulation fast path for fixed grids.
+ *
+ * Deployments run a handful of fixed grid sizes, so this template
+ * mirrors the runtime Game's update rules with the dimensions baked in
+ * as constants: indexing constant-folds, power-of-two widths use
+ * shift/mask addressing, and all state lives in fixed-size inline
+ * arrays with zero heap allocation. The runtime Game stays the generic
+ * fallback and keeps the recorder/snapshot/dirty-render hooks; this
+ * path is for raw training throughput. Large specializations are big
+ * objects — heap-allocate them (e.g. std::make_unique) rather than
+ * putting a 256x256 board on the stack.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+#include "game.h"
+
+/**
+ * @brief Snake simulation with compile-time grid dimensions.
+ * @tparam W Grid width
+ * @tparam H Grid height
+ */
+template <int W, int H>
+struct StaticGame
+{
+    static constexpr int WIDTH = W;      /**< Grid width */
+    static constexpr int HEIGHT = H;     /**< Grid height */
+    static constexpr int CELLS = W * H;  /**< Total cell count */
+
+    /** @brief True when rows can be addressed with shift instead of multiply. */
+    static constexpr bool ROW_SHIFT = (W & (W - 1)) == 0;
+
+    /** @brief True when ring indices can wrap with a mask. */
+    static constexpr bool RING_MASK = (CELLS & (CELLS - 1)) == 0;
+
+    std::array<Vector2Int, CELLS> body;      /**< Ring buffer of segments */
+    int headIdx = 0;                         /**< Ring index of the head */
+    int length = 0;                          /**< Segment count */
+    std::array<bool, CELLS> occupancy{};     /**< Per-cell snake occupancy */
+    std::array<Vector2Int, CELLS> freeCells; /**< Dense array of empty cells */
+    std::array<std::int32_t, CELLS> freeSlot; /**< freeCells slot per cell, -1 if occupied */
+    int freeCount = 0;                       /**< Number of empty cells */
+    Vector2Int apple{};                      /**< Current apple position */
+    Direction direction = Direction::RIGHT;  /**< Current snake direction */
+    DirectionQueue directionQueue;           /**< Pending direction changes */
+    Xoshiro256 rng;                          /**< Apple-placement PRNG */
+
+    /**
+     * @brief Cell index for a coordinate, constant-folded per grid.
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Flat cell index
+     */
+    static constexpr int Cell(int x, int y)
+    {
+        if constexpr (ROW_SHIFT)
+            return (y << std::countr_zero(static_cast<unsigned>(W))) | x;
+        else
+            return y * W + x;
+    }
+
+    /** @brief Wraps a ring index decremented past zero. */
+    static constexpr int RingPrev(int idx)
+    {
+        if constexpr (RING_MASK)
+            return (idx - 1) & (CELLS - 1);
+        else
+            return idx == 0 ? CELLS - 1 : idx - 1;
+    }
+
+    /** @brief Current head position. */
+    const Vector2Int &Head() const { return body[headIdx]; }
+
+    /**
+     * @brief Reseeds the PRNG and resets snake and apple.
+     * @param seed Seed for deterministic replay
+     */
+    void Reset(std::uint64_t seed)
+    {
+        rng.Seed(seed);
+        Reset();
+    }
+
+    /**
+     * @brief Resets snake and apple; the PRNG stream continues.
+     */
+    void Reset()
+    {
+        occupancy.fill(false);
+        for (int cell = 0; cell < CELLS; ++cell)
+        {
+            freeCells[cell] = {cell % W, cell / W};
+            freeSlot[cell] = cell;
+        }
+        freeCount = CELLS;
+
+        // The heading carries over across resets, and the body trails
+        // opposite to it — exactly like ResetGame, so the two engines
+        // stay in lockstep from the same seed across deaths.
+        Vector2Int head = {W / 2, H / 2};
+        Vector2Int offset = OffsetFromDirection(direction);
+        headIdx = 0;
+        length = 0;
+        for (int i = 0; i < 3; ++i)
+        {
+            body[i] = {head.x - offset.x * i, head.y - offset.y * i};
+            Occupy(body[i]);
+            ++length;
+        }
+
+        apple = freeCount ? freeCells[rng.NextBelow(freeCount)] : Vector2Int{0, 0};
+    }
+
+    /**
+     * @brief Adds a valid direction to the movement queue.
+     * @param newDirection Direction to enqueue
+     */
+    void QueueDirection(Direction newDirection)
+    {
+        using enum Direction;
+        if (directionQueue.size() >= 3)
+            return;
+
+        Direction lastDirection = directionQueue.empty() ? direction : directionQueue.back();
+
+        if ((newDirection == LEFT && lastDirection != RIGHT) ||
+            (newDirection == RIGHT && lastDirection != LEFT) ||
+            (newDirection == UP && lastDirection != DOWN) ||
+            (newDirection == DOWN && lastDirection != UP))
+        {
+            directionQueue.push(newDirection);
+        }
+    }
+
+    /**
+     * @brief Advances the snake one tick.
+     * @return True if game over occurs, false otherwise
+     */
+    bool Update()
+    {
+        if (!directionQueue.empty())
+        {
+            direction = directionQueue.front();
+            directionQueue.pop();
+        }
+
+        Vector2Int offset = OffsetFromDirection(direction);
+        Vector2Int newHead{Head().x + offset.x, Head().y + offset.y};
+
+        if (newHead.x < 0 || newHead.x >= W || newHead.y < 0 || newHead.y >= H ||
+            occupancy[Cell(newHead.x, newHead.y)])
+            return true;
+
+        headIdx = RingPrev(headIdx);
+        body[headIdx] = newHead;
+        ++length;
+        Occupy(newHead);
+
+        if (newHead == apple)
+        {
+            apple = freeCount ? freeCells[rng.NextBelow(freeCount)] : Vector2Int{0, 0};
+        }
+        else
+        {
+            int tailIdx = headIdx + length - 1;
+            if constexpr (RING_MASK)
+                tailIdx &= CELLS - 1;
+            else
+                tailIdx = tailIdx >= CELLS ? tailIdx - CELLS : tailIdx;
+            Vacate(body[tailIdx]);
+            --length;
+        }
+
+        return false;
+    }
+
+private:
+    /** @brief Marks a cell occupied, swap-removing it from the free index. */
+    void Occupy(const Vector2Int &pos)
+    {
+        int cell = Cell(pos.x, pos.y);
+        occupancy[cell] = true;
+
+        int slot = freeSlot[cell];
+        Vector2Int last = freeCells[freeCount - 1];
+        freeCells[slot] = last;
+        freeSlot[Cell(last.x, last.y)] = slot;
+        --freeCount;
+        freeSlot[cell] = -1;
+    }
+
+    /** @brief Marks a cell empty, appending it to the free index. */
+    void Vacate(const Vector2Int &pos)
+    {
+        int cell = Cell(pos.x, pos.y);
+        occupancy[cell] = false;
+        freeSlot[cell] = freeCount;
+        freeCells[freeCount++] = pos;
+    }
+};
@@ -0,0 +1,84 @@
+/**
+ * @file telemetry.cpp
+ * @brief Implementation of the telemetry sink's flush thread.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#include "telemetry.h"
+
+#include <chrono>
+#include <cstring>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/** @brief How long the flush thread sleeps between drains. */
+static constexpr auto FLUSH_INTERVAL = std::chrono::milliseconds(50);
+
+bool TelemetrySink::Open(const char *path)
+{
+    file = std::fopen(path, "wb");
+    if (!file)
+        return false;
+
+    TelemetryHeader header{};
+    std::memcpy(header.magic, "SNKT", 4);
+    header.version = 1;
+    header.recordSize = sizeof(TelemetryRecord);
+    std::fwrite(&header, sizeof(header), 1, file);
+
+    running.store(true, std::memory_order_release);
+    flusher = std::thread(&TelemetrySink::FlushLoop, this);
+    return true;
+}
+
+void TelemetrySink::Drain()
+{
+    TelemetryRecord batch[FLUSH_BATCH];
+
+    for (;;)
+    {
+        std::uint32_t t = tail.load(std::memory_order_relaxed);
+        std::uint32_t available = head.load(std::memory_order_acquire) - t;
+        if (available == 0)
+            return;
+
+        int count = available < FLUSH_BATCH ? static_cast<int>(available) : FLUSH_BATCH;
+        for (int i = 0; i < count; ++i)
+            batch[i] = slots[(t + i) & (CAPACITY - 1)];
+        tail.store(t + count, std::memory_order_release);
+
+        std::fwrite(batch, sizeof(TelemetryRecord), count, file);
+    }
+}
+
+void TelemetrySink::FlushLoop()
+{
+#ifdef __linux__
+    // Telemetry only runs when every other thread is idle.
+    sched_param param{};
+    pthread_setschedparam(pthread_self(), SCHED_IDLE, &param);
+#endif
+
+    while (running.load(std::memory_order_acquire))
+    {
+        std::this_thread::sleep_for(FLUSH_INTERVAL);
+        Drain();
+    }
+}
+
+void TelemetrySink::Close()
+{
+    if (!file)
+        return;
+
+    running.store(false, std::memory_order_release);
+    flusher.join();
+    Drain();
+    std::fclose(file);
+    file = nullptr;
+}
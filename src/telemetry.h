@@ -0,0 +1,116 @@
+/**
+ * @file telemetry.h
+ * @brief Wait-free per-tick telemetry with a background flush thread.
+ *
+ * The simulation thread pushes fixed-size records into a
+ * single-producer single-consumer ring buffer; a low-priority flush
+ * thread drains the ring in batches and writes them to disk. The
+ * producer side never blocks, never allocates, and never touches the
+ * filesystem — when the ring is full the record is dropped and
+ * counted, so a stalled disk can cost data but never a tick.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+/**
+ * @brief One tick's worth of telemetry, fixed size for raw batch I/O.
+ */
+struct TelemetryRecord
+{
+    std::uint32_t tick;          /**< Tick index since the sink opened */
+    std::uint16_t length;        /**< Snake length */
+    std::uint16_t appleDistance; /**< Manhattan distance from head to apple */
+    std::uint32_t updateNs;      /**< Update() duration in nanoseconds */
+    std::uint32_t inputToTickNs; /**< Input arrival to consuming tick, 0 if none */
+};
+
+/**
+ * @brief On-disk header preceding the raw record stream.
+ */
+struct TelemetryHeader
+{
+    char magic[4];            /**< "SNKT" */
+    std::uint32_t version;    /**< Format version, currently 1 */
+    std::uint32_t recordSize; /**< sizeof(TelemetryRecord) when written */
+};
+
+/**
+ * @brief Telemetry sink owning the ring buffer and its flush thread.
+ *
+ * Open() starts the flush thread; Record() is the wait-free producer
+ * entry point; Close() drains what is left and joins. A sink that was
+ * never opened swallows records for free, so call sites need no
+ * enabled-checks.
+ */
+class TelemetrySink
+{
+public:
+    ~TelemetrySink() { Close(); }
+
+    /**
+     * @brief Opens the output file and starts the flush thread.
+     * @param path Output file path
+     * @return True if the file was opened
+     */
+    bool Open(const char *path);
+
+    /**
+     * @brief Pushes one record; wait-free, allocation-free.
+     *
+     * Silently ignored when the sink is not open; dropped and counted
+     * when the ring is full.
+     *
+     * @param record Record to enqueue
+     */
+    void Record(const TelemetryRecord &record)
+    {
+        if (!running.load(std::memory_order_relaxed))
+            return;
+
+        std::uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= CAPACITY)
+        {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        slots[h & (CAPACITY - 1)] = record;
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Drains remaining records, stops the flush thread, closes the file.
+     */
+    void Close();
+
+    /** @brief Records dropped because the ring was full. */
+    std::uint64_t Dropped() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    /** @brief Ring capacity in records; must be a power of two. */
+    static constexpr std::uint32_t CAPACITY = 1 << 14;
+
+    /** @brief Records per fwrite batch on the flush thread. */
+    static constexpr int FLUSH_BATCH = 512;
+
+    /** @brief Flush thread body: periodic batched drain of the ring. */
+    void FlushLoop();
+
+    /** @brief Drains everything currently in the ring to the file. */
+    void Drain();
+
+    TelemetryRecord slots[CAPACITY];   /**< Ring storage */
+    std::atomic<std::uint32_t> head{0}; /**< Producer cursor, free-running */
+    std::atomic<std::uint32_t> tail{0}; /**< Consumer cursor, free-running */
+    std::atomic<std::uint64_t> dropped{0}; /**< Records lost to a full ring */
+    std::atomic<bool> running{false};  /**< True between Open and Close */
+    std::FILE *file = nullptr;         /**< Output stream, flush thread only */
+    std::thread flusher;               /**< Background flush thread */
+};
@@ -0,0 +1,240 @@
+/**
+ * @file territory.cpp
+ * @brief Implementation of the incremental territory engine.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#include "territory.h"
+
+#include <atomic>
+#include <barrier>
+#include <bit>
+#include <thread>
+
+TerritoryMap::TerritoryMap(int width, int height, int threadCount)
+    : blocked(width, height), threadCount(threadCount)
+{
+}
+
+void TerritoryMap::Rebuild(const Game &game)
+{
+    blocked.words.assign(blocked.words.size(), 0);
+    for (int i = 0; i < game.snake.size(); ++i)
+        blocked.Set(game.snake[i].x, game.snake[i].y);
+}
+
+void TerritoryMap::Sync(const Game &game)
+{
+    int length = game.snake.size();
+    if (length == 0)
+    {
+        Rebuild(game);
+        lastLength = 0;
+        ++version;
+        return;
+    }
+
+    Vector2Int head = game.snake.front();
+    Vector2Int tail = game.snake.back();
+    if (lastLength == length && head == lastHead && tail == lastTail)
+        return;
+
+    // One tick advanced the head by one cell from where it was, and
+    // either moved the tail (same length) or grew (ate the apple).
+    bool singleTick = lastLength > 0 && length >= 2 && game.snake[1] == lastHead &&
+                      (length == lastLength || length == lastLength + 1);
+    if (singleTick)
+    {
+        blocked.Set(head.x, head.y);
+        // Moving into the vacating tail cell is death in this engine,
+        // so the new head never aliases the cell cleared here.
+        if (length == lastLength)
+            blocked.Clear(lastTail.x, lastTail.y);
+    }
+    else
+    {
+        Rebuild(game);
+    }
+
+    lastHead = head;
+    lastTail = tail;
+    lastLength = length;
+    ++version;
+}
+
+void TerritoryMap::Compute(const Game &game)
+{
+    if (computedVersion == version)
+        return;
+
+    Vector2Int head = game.snake.front();
+    int rowWords = blocked.rowWords;
+
+    visited.assign(blocked.words.size(), 0);
+    visited[head.y * rowWords + (head.x >> 6)] = 1ULL << (head.x & 63);
+    next.assign(blocked.words.size(), 0);
+    distances.assign(blocked.width * blocked.height, 0xFFFF);
+    distances[head.y * blocked.width + head.x] = 0;
+    reachable = 1;
+
+    if (threadCount > 1 && blocked.height >= threadCount * MIN_ROWS_PER_WORKER)
+        ComputeParallel();
+    else
+        ComputeSerial();
+
+    computedVersion = version;
+}
+
+/**
+ * @brief Computes one dilated, unblocked row of the next BFS wave.
+ *
+ * Reads only the un-dilated visited words, so rows can be produced in
+ * any order or in parallel. Already-visited bits are kept even where
+ * blocked, which preserves the head seed (the head cell is occupied).
+ */
+static inline void NextRow(const std::uint64_t *visited, const std::uint64_t *blockedWords,
+                           std::uint64_t *out, int y, int height, int rowWords,
+                           std::uint64_t tailMask)
+{
+    const std::uint64_t *row = visited + y * rowWords;
+    const std::uint64_t *up = y > 0 ? row - rowWords : nullptr;
+    const std::uint64_t *down = y + 1 < height ? row + rowWords : nullptr;
+
+    for (int w = 0; w < rowWords; ++w)
+    {
+        std::uint64_t center = row[w];
+        std::uint64_t left = center >> 1;
+        std::uint64_t right = center << 1;
+        if (w + 1 < rowWords)
+            left |= row[w + 1] << 63;
+        if (w > 0)
+            right |= row[w - 1] >> 63;
+
+        std::uint64_t merged = left | right;
+        if (up)
+            merged |= up[w];
+        if (down)
+            merged |= down[w];
+
+        std::uint64_t valid = w == rowWords - 1 ? tailMask : ~0ULL;
+        out[y * rowWords + w] = (merged & valid & ~blockedWords[y * rowWords + w]) | center;
+    }
+}
+
+void TerritoryMap::ComputeSerial()
+{
+    int rowWords = blocked.rowWords;
+
+    for (std::uint16_t wave = 1;; ++wave)
+    {
+        for (int y = 0; y < blocked.height; ++y)
+            NextRow(visited.data(), blocked.words.data(), next.data(),
+                    y, blocked.height, rowWords, blocked.tailMask);
+
+        bool grew = false;
+        for (int y = 0; y < blocked.height; ++y)
+        {
+            for (int w = 0; w < rowWords; ++w)
+            {
+                std::uint64_t fresh = next[y * rowWords + w] & ~visited[y * rowWords + w];
+                while (fresh)
+                {
+                    int bit = std::countr_zero(fresh);
+                    fresh &= fresh - 1;
+                    distances[y * blocked.width + w * 64 + bit] = wave;
+                    ++reachable;
+                    grew = true;
+                }
+            }
+        }
+        if (!grew)
+            return;
+        std::swap(visited, next);
+    }
+}
+
+void TerritoryMap::ComputeParallel()
+{
+    int rowWords = blocked.rowWords;
+    int height = blocked.height;
+    int rowsPerWorker = (height + threadCount - 1) / threadCount;
+
+    std::barrier sync(threadCount);
+    std::atomic<bool> grew{false};
+    std::atomic<int> freshTotal{0};
+    bool done = false;
+    std::uint16_t wave = 1;
+
+    auto work = [&](int worker)
+    {
+        int yBegin = worker * rowsPerWorker;
+        int yEnd = yBegin + rowsPerWorker < height ? yBegin + rowsPerWorker : height;
+
+        for (;;)
+        {
+            // Phase 1: each worker produces its row band of the next wave.
+            for (int y = yBegin; y < yEnd; ++y)
+                NextRow(visited.data(), blocked.words.data(), next.data(),
+                        y, height, rowWords, blocked.tailMask);
+            sync.arrive_and_wait();
+
+            // Phase 2: each worker stamps distances for its band's fresh cells.
+            int local = 0;
+            for (int y = yBegin; y < yEnd; ++y)
+            {
+                for (int w = 0; w < rowWords; ++w)
+                {
+                    std::uint64_t fresh = next[y * rowWords + w] & ~visited[y * rowWords + w];
+                    while (fresh)
+                    {
+                        int bit = std::countr_zero(fresh);
+                        fresh &= fresh - 1;
+                        distances[y * blocked.width + w * 64 + bit] = wave;
+                        ++local;
+                    }
+                }
+            }
+            if (local)
+            {
+                grew.store(true, std::memory_order_relaxed);
+                freshTotal.fetch_add(local, std::memory_order_relaxed);
+            }
+            sync.arrive_and_wait();
+
+            // Phase 3: worker 0 advances the wave while the rest wait.
+            if (worker == 0)
+            {
+                reachable += freshTotal.exchange(0, std::memory_order_relaxed);
+                if (!grew.exchange(false, std::memory_order_relaxed))
+                    done = true;
+                ++wave;
+                std::swap(visited, next);
+            }
+            sync.arrive_and_wait();
+            if (done)
+                return;
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount - 1);
+    for (int worker = 1; worker < threadCount; ++worker)
+        workers.emplace_back(work, worker);
+    work(0);
+    for (std::thread &thread : workers)
+        thread.join();
+}
+
+const std::vector<std::uint16_t> &TerritoryMap::Distances(const Game &game)
+{
+    Compute(game);
+    return distances;
+}
+
+int TerritoryMap::Reachable(const Game &game)
+{
+    Compute(game);
+    return reachable;
+}
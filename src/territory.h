@@ -0,0 +1,103 @@
+/**
+ * @file territory.h
+ * @brief Incremental reachability and distance maps for bot evaluation.
+ *
+ * Wraps the board_analysis kernels in a stateful engine: the blocked
+ * bitboard follows the game tick by tick with O(1) bit updates instead
+ * of being re-derived from Game::snake on every query, and the
+ * head-distance map is recomputed lazily, at most once per tick no
+ * matter how many times a bot reads it. On large boards the BFS waves
+ * can run tile-parallel across worker threads.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "board_analysis.h"
+#include "game.h"
+
+/**
+ * @brief Tracks reachable territory for one game across ticks.
+ *
+ * Call Sync() once after every Update(); a single tick is applied as
+ * two bit flips, and anything the engine cannot reconcile (reset,
+ * rollback, missed ticks) falls back to an O(length) rebuild from the
+ * snake body. Distances() and Reachable() then serve the current
+ * tick's map from cache.
+ */
+class TerritoryMap
+{
+public:
+    /**
+     * @brief Construct an engine for a grid size.
+     * @param width Grid width
+     * @param height Grid height
+     * @param threadCount Worker threads for the BFS; 1 = serial
+     */
+    TerritoryMap(int width, int height, int threadCount = 1);
+
+    /**
+     * @brief Brings the blocked board in line with the game.
+     *
+     * Call after every Update(). Detects the common single-tick delta
+     * (head advanced, tail moved or apple grown) and applies it in
+     * O(1); otherwise rebuilds from the snake body.
+     *
+     * @param game Game to follow
+     */
+    void Sync(const Game &game);
+
+    /**
+     * @brief Per-cell BFS distance from the snake's head.
+     *
+     * Recomputed only when a Sync() changed the board since the last
+     * call; repeated reads within a tick are free.
+     *
+     * @param game Game whose head to measure from
+     * @return width * height distances, 0xFFFF = unreachable
+     */
+    const std::vector<std::uint16_t> &Distances(const Game &game);
+
+    /**
+     * @brief Number of cells the head can reach, head cell included.
+     * @param game Game whose head to flood from
+     * @return Reachable cell count
+     */
+    int Reachable(const Game &game);
+
+    /** @brief Blocked-cell board the engine maintains. */
+    const Bitboard &Blocked() const { return blocked; }
+
+private:
+    /** @brief Minimum rows per worker before the parallel path engages. */
+    static constexpr int MIN_ROWS_PER_WORKER = 32;
+
+    /** @brief Rebuilds the blocked board from the snake body. */
+    void Rebuild(const Game &game);
+
+    /** @brief Runs the BFS from the head and refreshes the cached map. */
+    void Compute(const Game &game);
+
+    /** @brief Serial word-parallel BFS. */
+    void ComputeSerial();
+
+    /** @brief Row-band tile-parallel BFS across threadCount workers. */
+    void ComputeParallel();
+
+    Bitboard blocked;          /**< Cells a move cannot enter */
+    int threadCount;           /**< Workers for the parallel BFS path */
+    Vector2Int lastHead{};     /**< Head cell after the last Sync */
+    Vector2Int lastTail{};     /**< Tail cell after the last Sync */
+    int lastLength = 0;        /**< Snake length after the last Sync, 0 = unsynced */
+    std::uint64_t version = 0; /**< Bumped by every Sync that changed the board */
+    std::uint64_t computedVersion = ~0ULL; /**< Version the cached map was built at */
+    int reachable = 0;         /**< Cached reachable-cell count */
+    std::vector<std::uint16_t> distances;   /**< Cached per-cell distances */
+    std::vector<std::uint64_t> visited;     /**< BFS frontier accumulator */
+    std::vector<std::uint64_t> next;        /**< BFS next-wave scratch */
+};
@@ -0,0 +1,89 @@
+/**
+ * @file tick_scheduler.h
+ * @brief Fixed-timestep accumulator decoupling simulation from rendering.
+ *
+ * Replaces the old moveTimer pattern, which zeroed the accumulator on
+ * every tick and silently slowed the simulation under frame hitches.
+ * The scheduler carries leftover time across frames, can run several
+ * ticks per frame to catch up, supports tick rates far above the frame
+ * rate for fast-forward replays, and exposes an interpolation alpha for
+ * sub-tick rendering.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+/**
+ * @brief Fixed-timestep accumulator scheduler.
+ *
+ * Feed it real frame times; it answers how many fixed ticks to run and
+ * how far into the next tick the current frame lies.
+ */
+class TickScheduler
+{
+public:
+    /**
+     * @brief Construct a scheduler.
+     * @param tickInterval Seconds of simulated time per tick
+     * @param maxTicksPerFrame Catch-up cap so a long stall cannot
+     *        trigger an unbounded burst of ticks
+     */
+    explicit TickScheduler(double tickInterval, int maxTicksPerFrame = 240)
+        : interval(tickInterval), maxTicks(maxTicksPerFrame) {}
+
+    /**
+     * @brief Changes the tick interval (e.g. for fast-forward replay).
+     * @param tickInterval Seconds of simulated time per tick
+     */
+    void SetInterval(double tickInterval) { interval = tickInterval; }
+
+    /**
+     * @brief Accumulates a frame's elapsed time and returns due ticks.
+     *
+     * Leftover time below one interval stays in the accumulator instead
+     * of being dropped. If more than maxTicksPerFrame ticks are due,
+     * the excess time is discarded so the simulation lags rather than
+     * spiraling.
+     *
+     * @param frameTime Seconds elapsed since the previous frame
+     * @return Number of fixed ticks to run now
+     */
+    int Advance(double frameTime)
+    {
+        accumulator += frameTime;
+
+        int ticks = static_cast<int>(accumulator / interval);
+        if (ticks > maxTicks)
+        {
+            ticks = maxTicks;
+            accumulator = 0.0;
+        }
+        else
+        {
+            accumulator -= ticks * interval;
+        }
+        return ticks;
+    }
+
+    /**
+     * @brief Fraction of the next tick already elapsed, in [0, 1).
+     *
+     * Renderers can use this to interpolate motion between the previous
+     * and current simulation states.
+     *
+     * @return Interpolation alpha
+     */
+    double Alpha() const { return accumulator / interval; }
+
+    /**
+     * @brief Drops any accumulated time, e.g. after a game reset.
+     */
+    void Reset() { accumulator = 0.0; }
+
+private:
+    double interval;          /**< Seconds per tick */
+    int maxTicks;             /**< Catch-up cap per Advance call */
+    double accumulator = 0.0; /**< Unspent simulated time in seconds */
+};
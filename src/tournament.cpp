@@ -0,0 +1,92 @@
+/**
+ * @file tournament.cpp
+ * @brief Implementation of the work-stealing tournament runner.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#include "tournament.h"
+
+#include <thread>
+
+TournamentRunner::TournamentRunner(int width, int height, long maxTicksPerGame, int threadCount)
+    : width(width), height(height), maxTicksPerGame(maxTicksPerGame),
+      threadCount(threadCount > 0 ? threadCount
+                                  : static_cast<int>(std::thread::hardware_concurrency()))
+{
+    if (this->threadCount < 1)
+        this->threadCount = 1;
+}
+
+long TournamentRunner::NextGame(int worker, std::vector<WorkQueue> &queues)
+{
+    {
+        WorkQueue &own = queues[worker];
+        std::lock_guard lock(own.mutex);
+        if (!own.games.empty())
+        {
+            long game = own.games.back();
+            own.games.pop_back();
+            return game;
+        }
+    }
+
+    // Own queue is dry: steal from the front of the busiest-looking victim.
+    int count = static_cast<int>(queues.size());
+    for (int i = 1; i < count; ++i)
+    {
+        WorkQueue &victim = queues[(worker + i) % count];
+        std::lock_guard lock(victim.mutex);
+        if (!victim.games.empty())
+        {
+            long game = victim.games.front();
+            victim.games.pop_front();
+            return game;
+        }
+    }
+    return -1;
+}
+
+TournamentResult TournamentRunner::PlayGame(std::uint64_t seed, const Policy &policy) const
+{
+    Game game(width, height, Direction::RIGHT, {0, 0}, {});
+    ResetGame(game, seed);
+
+    long tick = 0;
+    for (; tick < maxTicksPerGame; ++tick)
+    {
+        QueueDirection(game, policy(game, tick));
+        if (Update(game))
+            break;
+    }
+
+    return {seed, game.snake.size(), tick};
+}
+
+std::vector<TournamentResult> TournamentRunner::Run(long gameCount, std::uint64_t baseSeed,
+                                                    const Policy &policy)
+{
+    std::vector<TournamentResult> results(gameCount);
+    std::vector<WorkQueue> queues(threadCount);
+
+    // Deal games round-robin; queues only shrink after this point.
+    for (long game = 0; game < gameCount; ++game)
+        queues[game % threadCount].games.push_back(game);
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+    for (int worker = 0; worker < threadCount; ++worker)
+    {
+        workers.emplace_back([&, worker]
+        {
+            Policy localPolicy = policy;
+            for (long game; (game = NextGame(worker, queues)) >= 0;)
+                results[game] = PlayGame(baseSeed + game, localPolicy);
+        });
+    }
+
+    for (auto &worker : workers)
+        worker.join();
+    return results;
+}
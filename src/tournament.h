@@ -0,0 +1,93 @@
+/**
+ * @file tournament.h
+ * @brief Multi-threaded runner sharding independent games across cores.
+ *
+ * Tournament nights used to run tens of thousands of games one after
+ * another on the main thread. TournamentRunner plays each game to
+ * completion on a worker pool: every worker owns a queue of game
+ * numbers, pops from its own back, and steals from another worker's
+ * front when it runs dry, so load stays balanced even when game
+ * lengths vary wildly. Results are written into per-game slots of a
+ * preallocated array, so publishing needs no locks.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "game.h"
+
+/**
+ * @brief Outcome of one tournament game.
+ */
+struct TournamentResult
+{
+    std::uint64_t seed; /**< Seed the game was played with */
+    int finalLength;    /**< Snake length when the game ended */
+    long ticks;         /**< Ticks survived (maxTicks if never died) */
+};
+
+/**
+ * @brief Plays many independent games to completion on a thread pool.
+ */
+class TournamentRunner
+{
+public:
+    /**
+     * @brief Bot policy: picks a direction from the game state each tick.
+     */
+    using Policy = std::function<Direction(const Game &, long tick)>;
+
+    /**
+     * @brief Construct a runner.
+     * @param width Grid width for every game
+     * @param height Grid height for every game
+     * @param maxTicksPerGame Tick cap after which a game counts as survived
+     * @param threadCount Worker threads; 0 means hardware concurrency
+     */
+    TournamentRunner(int width, int height, long maxTicksPerGame, int threadCount = 0);
+
+    /**
+     * @brief Runs a batch of games and blocks until all finish.
+     *
+     * Game i is seeded with baseSeed + i, so any result can be replayed
+     * deterministically on its own.
+     *
+     * @param gameCount Number of games to play
+     * @param baseSeed Seed of game 0
+     * @param policy Bot policy, copied into each worker
+     * @return One result per game, indexed by game number
+     */
+    std::vector<TournamentResult> Run(long gameCount, std::uint64_t baseSeed, const Policy &policy);
+
+private:
+    /**
+     * @brief A worker's queue of pending game numbers.
+     *
+     * The owner pops from the back; thieves take from the front. The
+     * mutex is held only for the pop itself, never while playing.
+     */
+    struct WorkQueue
+    {
+        std::mutex mutex;       /**< Guards games */
+        std::deque<long> games; /**< Pending game numbers */
+    };
+
+    /** @brief Pops the owner's next game, or steals one; -1 when none left. */
+    long NextGame(int worker, std::vector<WorkQueue> &queues);
+
+    /** @brief Plays one game to completion and returns its result. */
+    TournamentResult PlayGame(std::uint64_t seed, const Policy &policy) const;
+
+    int width;            /**< Grid width */
+    int height;           /**< Grid height */
+    long maxTicksPerGame; /**< Per-game tick cap */
+    int threadCount;      /**< Number of worker threads */
+};
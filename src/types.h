@@ -0,0 +1,36 @@
+/**
+ * @file types.h
+ * @brief Shared basic types for the snake simulation.
+ *
+ * @author CJendantix
+ * @date 2026-08-26
+ */
+
+#pragma once
+
+/**
+ * @brief Represents the four possible movement directions of the snake.
+ */
+enum class Direction
+{
+    UP,    /**< Move up */
+    DOWN,  /**< Move down */
+    LEFT,  /**< Move left */
+    RIGHT  /**< Move right */
+};
+
+/**
+ * @brief Represents a 2D integer vector for grid coordinates.
+ */
+struct Vector2Int
+{
+    int x; /**< X coordinate */
+    int y; /**< Y coordinate */
+
+    /**
+     * @brief Equality operator.
+     * @param other Vector to compare
+     * @return True if both x and y match
+     */
+    bool operator==(const Vector2Int &other) const = default;
+};